@@ -13,9 +13,25 @@ add_executable(ftxui-benchmark
 ftxui_set_options(ftxui-benchmark)
 target_link_libraries(ftxui-benchmark
   PRIVATE dom
+  PRIVATE component
   PRIVATE benchmark::benchmark
   PRIVATE benchmark::benchmark_main
   )
 target_include_directories(ftxui-benchmark
   PRIVATE src
   )
+
+# Replaces the global operator new, to count the allocations. It must not be
+# linked with the other benchmarks.
+add_executable(ftxui-benchmark-allocations
+  src/ftxui/dom/benchmark_allocations_test.cpp
+  )
+ftxui_set_options(ftxui-benchmark-allocations)
+target_link_libraries(ftxui-benchmark-allocations
+  PRIVATE dom
+  PRIVATE benchmark::benchmark
+  PRIVATE benchmark::benchmark_main
+  )
+target_include_directories(ftxui-benchmark-allocations
+  PRIVATE src
+  )
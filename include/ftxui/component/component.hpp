@@ -9,6 +9,7 @@
 
 #include "ftxui/component/component_base.hpp"  // for Component, Components
 #include "ftxui/component/component_options.hpp"  // for ButtonOption, CheckboxOption, MenuOption
+#include "ftxui/component/keymap.hpp"  // for KeyBindings
 #include "ftxui/dom/elements.hpp"  // for Element
 #include "ftxui/util/ref.hpp"  // for ConstRef, Ref, ConstStringRef, ConstStringListRef, StringRef
 
@@ -99,8 +100,11 @@ Component Renderer(std::function<Element()>);
 Component Renderer(std::function<Element(bool /* focused */)>);
 ComponentDecorator Renderer(ElementDecorator);
 
-Component CatchEvent(Component child, std::function<bool(Event)>);
-ComponentDecorator CatchEvent(std::function<bool(Event)> on_event);
+Component CatchEvent(Component child, std::function<bool(const Event&)>);
+ComponentDecorator CatchEvent(std::function<bool(const Event&)> on_event);
+
+Component Keymap(Component child, KeyBindings bindings);
+ComponentDecorator Keymap(KeyBindings bindings);
 
 Component Maybe(Component, const bool* show);
 Component Maybe(Component, std::function<bool()>);
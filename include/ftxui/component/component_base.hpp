@@ -53,7 +53,7 @@ class ComponentBase {
   // By default, reduce on children with a lazy OR.
   //
   // Returns whether the event was handled or not.
-  virtual bool OnEvent(Event);
+  virtual bool OnEvent(const Event&);
 
   // Handle an animation step.
   virtual void OnAnimation(animation::Params& params);
@@ -106,7 +106,7 @@ class ContainerBase : public ComponentBase {
   int GetComponentType() override { return ct::container; }
 
   // Component override.
-  bool OnEvent(Event event) override {
+  bool OnEvent(const Event& event) override {
     if (event.is_mouse()) {
       return OnMouseEvent(event);
     }
@@ -166,9 +166,9 @@ class ContainerBase : public ComponentBase {
 
  protected:
   // Handlers
-  virtual bool EventHandler(Event ) { return false; }  // NOLINT
-  virtual bool OnMouseEvent(Event event) {
-    return ComponentBase::OnEvent(std::move(event));
+  virtual bool EventHandler(const Event& /*event*/) { return false; }  // NOLINT
+  virtual bool OnMouseEvent(const Event& event) {
+    return ComponentBase::OnEvent(event);
   }
 
   int selected_ = 0;
@@ -192,7 +192,7 @@ class VerticalContainer : public ContainerBase {
     return vbox(std::move(elements)) | reflect(box_);
   }
 
-  bool EventHandler(Event event) override {
+  bool EventHandler(const Event& event) override {
     const int old_selected = *selector_;
     //if (event == Event::ArrowUp || event == Event::Character('k')) {
     //  MoveSelector(-1);
@@ -231,7 +231,7 @@ class VerticalContainer : public ContainerBase {
     return old_selected != *selector_;
   }
 
-  bool OnMouseEvent(Event event) override {
+  bool OnMouseEvent(const Event& event) override {
     if (ContainerBase::OnMouseEvent(event)) {
       return true;
     }
@@ -279,7 +279,7 @@ class HorizontalContainer : public ContainerBase {
     return hbox(std::move(elements));
   }
 
-  bool EventHandler(Event event) override {
+  bool EventHandler(const Event& event) override {
     const int old_selected = *selector_;
     //if (event == Event::ArrowLeft || event == Event::Character('h')) {
     //  MoveSelector(-1);
@@ -318,7 +318,7 @@ class TabContainer : public ContainerBase {
     return children_[size_t(*selector_) % children_.size()]->Focusable();
   }
 
-  bool OnMouseEvent(Event event) override {
+  bool OnMouseEvent(const Event& event) override {
     return ActiveChild() && ActiveChild()->OnEvent(event);
   }
 };
@@ -2,6 +2,7 @@
 #define FTXUI_COMPONENT_EVENT_HPP
 
 #include <ftxui/component/mouse.hpp>  // for Mouse
+#include <cstdint>                    // for uint32_t
 #include <functional>
 #include <string>  // for string, operator==
 #include <vector>
@@ -17,6 +18,8 @@ class ComponentBase;
 /// For example:
 /// - Printable character can be created using Event::Character('a').
 /// - Some special are predefined, like Event::ArrowLeft.
+/// - A pasted text is received as a single Event::Paste(text), or several
+///   above 1MiB.
 /// - One can find arbitrary code for special Events using:
 ///   ./example/util/print_key_press
 ///  For instance, CTLR+A maps to Event::Special({1});
@@ -31,6 +34,7 @@ struct Event {
   static Event Special(std::string);
   static Event Mouse(std::string, Mouse mouse);
   static Event CursorReporting(std::string, int x, int y);
+  static Event Paste(std::string text);
 
   // --- Arrow ---
   static const Event ArrowLeft;
@@ -67,14 +71,26 @@ struct Event {
 
   bool is_mouse() const { return type_ == Type::Mouse; }
   struct Mouse& mouse() { return data_.mouse; }
+  const struct Mouse& mouse() const { return data_.mouse; }
 
   bool is_cursor_reporting() const { return type_ == Type::CursorReporting; }
   int cursor_x() const { return data_.cursor.x; }
   int cursor_y() const { return data_.cursor.y; }
 
+  // Text pasted by the user, received at once when the terminal supports
+  // bracketed paste.
+  bool is_paste() const { return type_ == Type::Paste; }
+  std::string paste() const;
+
   const std::string& input() const { return input_; }
 
-  bool operator==(const Event& other) const { return input_ == other.input_; }
+  // Special events are interned: they are compared in O(1), using their id.
+  bool operator==(const Event& other) const {
+    if (id_ && other.id_) {
+      return id_ == other.id_;
+    }
+    return input_ == other.input_;
+  }
   bool operator!=(const Event& other) const { return !operator==(other); }
 
   //--- State section ----------------------------------------------------------
@@ -88,6 +104,8 @@ struct Event {
     Character,
     Mouse,
     CursorReporting,
+    Paste,
+    Resize,  // Event::Custom, posted when the terminal is resized.
   };
   Type type_ = Type::Unknown;
 
@@ -101,6 +119,14 @@ struct Event {
     struct Cursor cursor;
   } data_ = {};
 
+  // Build one of the predefined special events, like ArrowUp.
+  static Event Predefined(std::string input);
+
+  // The index of |input_| in the table of predefined special events, plus one.
+  // Zero for the other events.
+  uint32_t id_ = 0;
+
+  // Characters fit in the small string buffer. Copying them doesn't allocate.
   std::string input_;
 };
 
@@ -25,6 +25,9 @@ namespace ftxui {
 // For instance, letters are grouped with number and form a single word.
 bool IsWordCharacter(WordBreakProperty property);
 std::string PasswordField(size_t size);
+// Remove the control characters, like new lines or tabs, which can't be typed
+// into a single line Input.
+std::string RemoveControlCharacters(const std::string& input);
 
 // An input box. The user can type text into it.
 class InputBase : public ComponentBase {
@@ -101,7 +104,7 @@ class InputBase : public ComponentBase {
            flex | frame | bold | main_decorator | reflect(box_);
   }
 
-  bool OnEvent(Event event) override {
+  bool OnEvent(const Event& event) override {
     cursor_position() =
         std::max(0, std::min<int>((int)content_->size(), cursor_position()));
 
@@ -192,6 +195,21 @@ class InputBase : public ComponentBase {
       option_->on_change();
       return true;
     }
+
+    // Paste, as a single edit.
+    if (event.is_paste()) {
+      const std::string pasted = RemoveControlCharacters(event.paste());
+      if (pasted.empty()) {
+        return false;
+      }
+      const size_t start = GlyphPosition(*content_, cursor_position());
+      content_->insert(start, pasted);
+      // A leading combining character merges into the glyph before it. Count
+      // the glyphs up to the end of the pasted text.
+      cursor_position() = GlyphCount(content_->substr(0, start + pasted.size()));
+      option_->on_change();
+      return true;
+    }
     return false;
   }
 
@@ -229,9 +247,13 @@ class InputBase : public ComponentBase {
     }
   }
 
-  bool OnMouseEvent(Event event) {
-    hovered_ =
+  bool OnMouseEvent(const Event& event) {
+    const bool hovered =
         box_.Contain(event.mouse().x, event.mouse().y) && CaptureMouse(event);
+    if (hovered != hovered_ && event.screen_) {
+      event.screen_->Invalidate();
+    }
+    hovered_ = hovered;
     if (!hovered_) {
       return false;
     }
@@ -0,0 +1,65 @@
+#ifndef FTXUI_COMPONENT_KEYMAP_HPP
+#define FTXUI_COMPONENT_KEYMAP_HPP
+
+#include <functional>        // for function
+#include <initializer_list>  // for initializer_list
+#include <memory>            // for shared_ptr, unique_ptr
+#include <string>            // for string
+#include <unordered_map>     // for unordered_map
+#include <vector>            // for vector
+
+#include "ftxui/component/event.hpp"  // for Event
+
+namespace ftxui {
+
+/// @brief A table of key bindings, used by the Keymap component decorator.
+///
+/// A binding associates a sequence of events to an action. A sequence made of
+/// several events is a chord, like `g g`. The bindings are stored into a trie
+/// indexed by a hash table, so the cost of dispatching an event doesn't depend
+/// on the number of bindings.
+///
+/// When a binding is the prefix of a longer one, its action is executed once
+/// the next event doesn't continue the longer one.
+///
+/// ### Example
+///
+/// ```cpp
+/// KeyBindings bindings;
+/// bindings.Bind(Event::Character('q'), screen.ExitLoopClosure());
+/// bindings.Bind({Event::Character('g'), Event::Character('g')},
+///               [&] { selected = 0; });
+/// component |= Keymap(bindings);
+/// ```
+/// @ingroup component
+class KeyBindings {
+ public:
+  KeyBindings();
+
+  KeyBindings& Bind(const Event& key, std::function<void()> action);
+  KeyBindings& Bind(const std::vector<Event>& keys,
+                    std::function<void()> action);
+  KeyBindings& Bind(std::initializer_list<Event> keys,
+                    std::function<void()> action);
+
+  // A node of the trie. The root is the empty sequence.
+  struct Node {
+    std::function<void()> action;
+    // Indexed by Event::input(), since it defines the equality of events.
+    std::unordered_map<std::string, std::unique_ptr<Node>> next;
+  };
+  const Node& root() const { return *root_; }
+
+ private:
+  // The copies share the same table. A binding added after the creation of a
+  // Keymap applies to it.
+  std::shared_ptr<Node> root_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_KEYMAP_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,89 @@
+#ifndef FTXUI_COMPONENT_MAILBOX_HPP_
+#define FTXUI_COMPONENT_MAILBOX_HPP_
+
+#include <memory>         // for unique_ptr, make_unique
+#include <mutex>          // for mutex, lock_guard
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
+
+namespace ftxui {
+
+// A channel keeping only the latest value sent for each key. Unlike Receiver,
+// a value replaces the one sent before with the same key, if it wasn't received
+// yet. This decouples the rate of the producers from the rate of the consumer,
+// with memory bounded by the number of keys.
+//
+// Usage:
+//
+// auto mailbox = MakeMailbox<std::string, int>();
+//
+// [thread 1] mailbox->Send("cpu", 10);
+// [thread 1] mailbox->Send("cpu", 12);  // Replaces 10.
+// [thread 2] mailbox->Send("memory", 80);
+//
+// std::vector<int> values;
+// mailbox->ReceiveAll(&values);  // {12, 80}
+
+// clang-format off
+template<class Key, class T> class MailboxImpl;
+template<class Key, class T> using Mailbox = std::unique_ptr<MailboxImpl<Key, T>>;
+template<class Key, class T> Mailbox<Key, T> MakeMailbox();
+// clang-format on
+
+// ---- Implementation part ----
+
+template <class Key, class T>
+class MailboxImpl {
+ public:
+  // Return whether the mailbox was empty. The consumer may need to be notified.
+  bool Send(Key key, T value) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    const bool was_empty = values_.empty();
+    auto [it, inserted] = index_.try_emplace(std::move(key), values_.size());
+    if (inserted) {
+      values_.push_back(std::move(value));
+    } else {
+      values_[it->second] = std::move(value);
+    }
+    return was_empty;
+  }
+
+  // Append every pending value to |out|, in the order their key was first sent.
+  // Return whether there was any.
+  bool ReceiveAll(std::vector<T>* out) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (values_.empty()) {
+      return false;
+    }
+    for (T& value : values_) {
+      out->push_back(std::move(value));
+    }
+    values_.clear();
+    index_.clear();
+    return true;
+  }
+
+  bool HasPending() {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return !values_.empty();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<T> values_;
+  std::unordered_map<Key, size_t> index_;  // Key -> index in |values_|.
+};
+
+template <class Key, class T>
+Mailbox<Key, T> MakeMailbox() {
+  return std::make_unique<MailboxImpl<Key, T>>();
+}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_COMPONENT_MAILBOX_HPP_
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
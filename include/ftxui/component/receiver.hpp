@@ -8,8 +8,8 @@
 #include <iostream>
 #include <memory>   // for unique_ptr, make_unique
 #include <mutex>    // for mutex, unique_lock
-#include <queue>    // for queue
 #include <utility>  // for move
+#include <vector>   // for vector
 
 namespace ftxui {
 
@@ -62,6 +62,12 @@ class SenderImpl {
   ReceiverImpl<T>* receiver_;
 };
 
+// A multi-producer single-consumer queue. Sending is lock-free: the items are
+// pushed onto a stack, which the consumer takes whole and reverses. The lock is
+// only used to put the consumer to sleep while there is nothing to receive.
+//
+// Every function, except MakeSender(), must be called from the consumer
+// thread.
 template <class T>
 class ReceiverImpl {
  public:
@@ -71,58 +77,118 @@ class ReceiverImpl {
     return std::unique_ptr<SenderImpl<T>>(new SenderImpl<T>(this));
   }
   ReceiverImpl() { senders_ = 0; }
+  ~ReceiverImpl() {
+    Delete(front_);
+    Delete(head_.load());
+  }
+  ReceiverImpl(const ReceiverImpl&) = delete;
+  ReceiverImpl(ReceiverImpl&&) = delete;
+  ReceiverImpl& operator=(const ReceiverImpl&) = delete;
+  ReceiverImpl& operator=(ReceiverImpl&&) = delete;
 
   bool Receive(T* t) {
-    while (senders_ || !queue_.empty()) {
-      std::unique_lock<std::mutex> lock(mutex_);
-      if (queue_.empty())
-        notifier_.wait(lock);
-      if (queue_.empty())
-        continue;
-      *t = std::move(queue_.front());
-      queue_.pop();
-      return true;
+    while (!ReceiveNonBlocking(t)) {
+      // The last items may have been sent right before the last sender left.
+      if (!senders_)
+        return ReceiveNonBlocking(t);
+      Wait();
     }
-    return false;
+    return true;
   }
 
   bool ReceiveNonBlocking(T* t) {
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (queue_.empty())
+    if (!front_)
+      front_ = Take();
+    if (!front_)
       return false;
-    *t = queue_.front();
-    queue_.pop();
+    Node* node = front_;
+    front_ = node->next;
+    *t = std::move(node->value);
+    delete node;  // NOLINT
     return true;
   }
 
-  bool HasPending() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    return !queue_.empty();
+  // Append every pending item to |out|, in a single pass. Never blocks.
+  // Return whether there was any.
+  bool ReceiveAll(std::vector<T>* out) {
+    const size_t size = out->size();
+    for (Node* node : {front_, Take()}) {
+      while (node) {
+        Node* next = node->next;
+        out->push_back(std::move(node->value));
+        delete node;  // NOLINT
+        node = next;
+      }
+    }
+    front_ = nullptr;
+    return out->size() != size;
   }
 
-  bool HasQuitted() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    return queue_.empty() && !senders_;
-  }
+  bool HasPending() { return front_ || head_.load(); }
+
+  bool HasQuitted() { return !HasPending() && !senders_; }
 
  private:
   friend class SenderImpl<T>;
 
+  struct Node {
+    T value;
+    Node* next;
+  };
+
   void Receive(T t) {
+    auto* node = new Node{std::move(t), head_.load()};  // NOLINT
+    while (!head_.compare_exchange_weak(node->next, node)) {
+    }
+
+    // Wake up the consumer only when it sleeps. The lock guarantees it either
+    // sees the new item before sleeping, or gets the notification.
+    if (waiting_) {
+      { std::unique_lock<std::mutex> lock(mutex_); }
+      notifier_.notify_one();
+    }
+  }
+
+  void ReleaseSender() {
     {
       std::unique_lock<std::mutex> lock(mutex_);
-      queue_.push(std::move(t));
+      senders_--;
     }
     notifier_.notify_one();
   }
 
-  void ReleaseSender() {
-    senders_--;
-    notifier_.notify_one();
+  // Take the items sent since the last call, in the order they were sent.
+  Node* Take() {
+    Node* node = head_.exchange(nullptr);
+    Node* reversed = nullptr;
+    while (node) {
+      Node* next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+    }
+    return reversed;
+  }
+
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiting_ = true;
+    notifier_.wait(lock, [&] { return head_.load() || !senders_; });
+    waiting_ = false;
+  }
+
+  static void Delete(Node* node) {
+    while (node) {
+      Node* next = node->next;
+      delete node;  // NOLINT
+      node = next;
+    }
   }
 
+  std::atomic<Node*> head_ = nullptr;  // Sent items, most recent first.
+  Node* front_ = nullptr;  // Taken items, not yet received, oldest first.
+  std::atomic<bool> waiting_ = false;
   std::mutex mutex_;
-  std::queue<T> queue_;
   std::condition_variable notifier_;
   std::atomic<int> senders_;
 };
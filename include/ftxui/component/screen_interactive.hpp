@@ -2,26 +2,35 @@
 #define FTXUI_COMPONENT_SCREEN_INTERACTIVE_HPP
 
 #include <atomic>                        // for atomic
+#include <chrono>                        // for microseconds
+#include <condition_variable>            // for condition_variable
+#include <ftxui/component/mailbox.hpp>   // for Mailbox
 #include <ftxui/component/receiver.hpp>  // for Receiver, Sender
 #include <functional>                    // for function
 #include <memory>                        // for shared_ptr
+#include <mutex>                         // for mutex
 #include <string>                        // for string
 #include <thread>                        // for thread
+#include <utility>                       // for pair
 #include <variant>                       // for variant
+#include <vector>                        // for vector
 
 #include "ftxui/component/animation.hpp"       // for TimePoint
 #include "ftxui/component/captured_mouse.hpp"  // for CapturedMouse
 #include "ftxui/component/event.hpp"           // for Event
+#include "ftxui/component/mouse.hpp"           // for Mouse
 #include "ftxui/component/task.hpp"            // for Task, Closure
 #include "ftxui/screen/screen.hpp"             // for Screen
 
 namespace ftxui {
+class Arena;
 class ComponentBase;
 class Loop;
 struct Event;
 
 using Component = std::shared_ptr<ComponentBase>;
 class ScreenInteractivePrivate;
+class TerminalInputParser;
 
 class ScreenInteractive : public Screen {
  public:
@@ -42,7 +51,20 @@ class ScreenInteractive : public Screen {
   // Post tasks to be executed by the loop.
   void Post(Task task);
   void PostEvent(Event event);
+  void PostLatest(const std::string& key, Closure closure);
   void RequestAnimationFrame();
+  void Invalidate();
+  void SetFrameRate(int frames_per_second);
+  void SetEventCoalescing(bool enabled);
+  void SetEscapeTimeout(int milliseconds);
+  void SetKittyKeyboardProtocol(bool enabled);
+  void SetFrameArena(bool enabled);
+
+  // POSIX only. Run everything on the thread running the loop, see
+  // SetReactorMode().
+  void SetReactorMode(bool enabled);
+  void WatchFileDescriptor(int fd, Closure on_readable);
+  void UnwatchFileDescriptor(int fd);
 
   CapturedMouse CaptureMouse();
 
@@ -68,13 +90,21 @@ class ScreenInteractive : public Screen {
   bool HasQuitted();
   void RunOnce(Component component);
   void RunOnceBlocking(Component component);
+  void HandleTasks(Component component);
+  void CoalesceEvents(std::vector<Task>* tasks);
 
   void HandleTask(Component component, Task& task);
   void Draw(Component component);
   void ResetCursorPosition();
+  bool FlushOutput();
+  void FlushOutputBlocking();
 
   void Signal(int signal);
 
+  void ArmFrameTimer();
+  void FrameTimer(Sender<Task> out);
+  void WaitReactor(int timeout);
+
   ScreenInteractive* suspended_screen_ = nullptr;
   enum class Dimension {
     FitComponent,
@@ -91,6 +121,9 @@ class ScreenInteractive : public Screen {
 
   Sender<Task> task_sender_;
   Receiver<Task> task_receiver_;
+  std::vector<Task> tasks_;  // Reused by HandleTasks() to receive tasks.
+  Mailbox<std::string, Closure> mailbox_;
+  std::vector<Closure> mailbox_closures_;  // Reused by HandleTasks().
 
   std::string set_cursor_position;
   std::string reset_cursor_position;
@@ -101,14 +134,51 @@ class ScreenInteractive : public Screen {
   bool animation_requested_ = false;
   animation::TimePoint previous_animation_time_;
 
+  // The timer sending AnimationTask. It is armed by RequestAnimationFrame(),
+  // and fires at most once per |frame_duration_|. It never wakes up otherwise.
+  std::mutex frame_timer_mutex_;
+  std::condition_variable frame_timer_cv_;
+  bool frame_timer_armed_ = false;
+  animation::TimePoint frame_timer_previous_;
+  std::chrono::microseconds frame_duration_{1'000'000 / 60};  // NOLINT
+
+  // Reactor mode: the loop waits with poll() for the terminal input, the tasks
+  // posted, and the file descriptors watched. No thread is started.
+  bool reactor_mode_ = false;
+  std::atomic<bool> reactor_waiting_ = false;
+  std::shared_ptr<TerminalInputParser> parser_;
+  bool stdin_closed_ = false;
+  std::vector<std::pair<int, Closure>> watched_fds_;
+
   int cursor_x_ = 1;
   int cursor_y_ = 1;
 
+  bool event_coalescing_ = true;
+  Mouse last_mouse_;  // The last mouse event received, before coalescing.
+
+  int escape_timeout_ = 50;  // NOLINT
+  bool kitty_keyboard_protocol_ = false;
+
+  std::shared_ptr<Arena> frame_arena_;  // See SetFrameArena().
+
   bool mouse_captured = false;
   bool previous_frame_resized_ = false;
 
   bool frame_valid_ = false;
 
+  // The last frame drawn in the alternate screen. Used to only output the
+  // modified cells.
+  Screen previous_frame_;
+
+  // The bytes to be sent to the terminal, using a single write per frame. When
+  // the terminal doesn't keep up, the first |output_written_| bytes are already
+  // sent, and the next frames are dropped until the rest is.
+  std::string output_buffer_;
+  size_t output_written_ = 0;
+  // The terminal, opened again without blocking. Or stdout, when it isn't a
+  // terminal.
+  int output_fd_ = 1;
+
   ComponentBase* CapturedComponent = nullptr;
 
   friend class Loop;
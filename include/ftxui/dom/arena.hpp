@@ -0,0 +1,141 @@
+#ifndef FTXUI_DOM_ARENA_HPP
+#define FTXUI_DOM_ARENA_HPP
+
+#include <cstddef>  // for size_t
+#include <memory>   // for allocator, allocate_shared, shared_ptr
+#include <utility>  // for forward
+
+namespace ftxui {
+
+struct ArenaGeneration;
+
+/// @brief A bump allocator for the elements of a frame.
+///
+/// While an ArenaScope is active, the elements built by the thread, and the
+/// scratch memory used by their layout, are allocated from the arena instead
+/// of the global heap. Reset() releases everything at once, and reuses the
+/// memory for the next frame.
+///
+/// The children of the elements are stored in the arena too. The Elements
+/// lists built by the caller, like the argument of hbox({...}), and the strings
+/// given to the elements are std containers using the global heap.
+///
+/// The memory is reused only once every element allocated since the previous
+/// Reset() is destroyed. An element kept longer stays valid, but its memory
+/// is released only when it is destroyed, and the next frame doesn't reuse
+/// it.
+///
+/// The arena must only be used by a single thread.
+///
+/// ### Example
+///
+/// ```cpp
+/// Arena arena;
+/// while (running) {
+///   {
+///     ArenaScope scope(&arena);
+///     Render(screen, document());
+///   }
+///   arena.Reset();
+/// }
+/// ```
+/// @ingroup dom
+class Arena {
+ public:
+  Arena();
+  ~Arena();
+  Arena(const Arena&) = delete;
+  Arena(Arena&&) = delete;
+  Arena& operator=(const Arena&) = delete;
+  Arena& operator=(Arena&&) = delete;
+
+  void Reset();
+
+  // Used by ArenaAllocator:
+  static ArenaGeneration* Current();
+  static void* Allocate(ArenaGeneration* generation,
+                        size_t size,
+                        size_t alignment);
+  static void Release(ArenaGeneration* generation);
+
+ private:
+  friend class ArenaScope;
+  ArenaGeneration* generation_;
+};
+
+/// @brief Allocate the elements built by the current thread from |arena|,
+/// until the end of the scope.
+/// @ingroup dom
+class ArenaScope {
+ public:
+  explicit ArenaScope(Arena* arena);
+  ~ArenaScope();
+  ArenaScope(const ArenaScope&) = delete;
+  ArenaScope(ArenaScope&&) = delete;
+  ArenaScope& operator=(const ArenaScope&) = delete;
+  ArenaScope& operator=(ArenaScope&&) = delete;
+
+ private:
+  Arena* previous_;
+};
+
+/// @brief A standard allocator using the arena active when it was created, or
+/// the global heap when there is none.
+/// @ingroup dom
+template <class T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  ArenaAllocator() : generation_(Arena::Current()) {}
+  template <class U>
+  ArenaAllocator(const ArenaAllocator<U>& other)  // NOLINT
+      : generation_(other.generation_) {}
+
+  T* allocate(size_t n) {
+    if (!generation_) {
+      return std::allocator<T>().allocate(n);
+    }
+    return static_cast<T*>(
+        Arena::Allocate(generation_, n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* p, size_t n) {
+    if (!generation_) {
+      std::allocator<T>().deallocate(p, n);
+      return;
+    }
+    Arena::Release(generation_);
+  }
+
+  template <class U>
+  bool operator==(const ArenaAllocator<U>& other) const {
+    return generation_ == other.generation_;
+  }
+  template <class U>
+  bool operator!=(const ArenaAllocator<U>& other) const {
+    return generation_ != other.generation_;
+  }
+
+ private:
+  template <class U>
+  friend class ArenaAllocator;
+  ArenaGeneration* generation_;
+};
+
+/// @brief Create a Node, from the active arena if any.
+/// This is equivalent to std::make_shared otherwise.
+/// @ingroup dom
+template <class T, class... Args>
+std::shared_ptr<T> MakeNode(Args&&... args) {
+  return std::allocate_shared<T>(ArenaAllocator<T>(),
+                                 std::forward<Args>(args)...);
+}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_ARENA_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
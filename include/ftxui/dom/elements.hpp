@@ -1,6 +1,7 @@
 #ifndef FTXUI_DOM_ELEMENTS_HPP
 #define FTXUI_DOM_ELEMENTS_HPP
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 
@@ -121,6 +122,12 @@ Element gridbox(std::vector<Elements> lines);
 Element hflow(Elements);  // Helper: default flexbox with row direction.
 Element vflow(Elements);  // Helper: default flexbox with column direction.
 
+// A vertical list building only the rows being displayed. See frame.
+Element virtualList(size_t count,
+                    int row_height,
+                    std::function<Element(size_t)> row,
+                    size_t selected = size_t(-1));
+
 // -- Flexibility ---
 // Define how to share the remaining space when not all of it is used inside a
 // container.
@@ -1,9 +1,11 @@
 #ifndef FTXUI_DOM_NODE_HPP
 #define FTXUI_DOM_NODE_HPP
 
+#include <limits>  // for numeric_limits
 #include <memory>  // for shared_ptr
 #include <vector>  // for vector
 
+#include "ftxui/dom/arena.hpp"        // for ArenaAllocator
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/screen.hpp"
@@ -20,6 +22,7 @@ class Node {
  public:
   Node();
   Node(Elements children);
+  Node(Element child);
   Node(const Node&) = delete;
   Node(const Node&&) = delete;
   Node& operator=(const Node&) = delete;
@@ -27,6 +30,12 @@ class Node {
 
   virtual ~Node();
 
+  // Step 0: Tell this element the width it can use at most. Elements wrapping
+  //         their content, like paragraphs, use it to find their requirement
+  //         in a single iteration of the layout.
+  //         Propagated from Parents to Children, before ComputeRequirement().
+  void SetAvailableWidth(int width) { available_width_ = width; }
+
   // Step 1: Compute layout requirement. Tell parent what dimensions this
   //         element wants to be.
   //         Propagated from Children to Parents.
@@ -35,10 +44,15 @@ class Node {
 
   // Step 2: Assign this element its final dimensions.
   //         Propagated from Parents to Children.
+  //         Overrides must call Node::SetBox(), since box() is used to skip
+  //         the elements outside of the stencil.
   virtual void SetBox(Box box);
+  const Box& box() const { return box_; }
 
   // Step 3: Draw this element.
+  //         The children outside of |screen.stencil| are skipped.
   virtual void Render(Screen& screen);
+  bool IsVisible(const Screen& screen) const;
 
   // Layout may not resolve within a single iteration for some elements. This
   // allows them to request additionnal iterations. This signal must be
@@ -50,9 +64,11 @@ class Node {
   virtual void Check(Status* status);
 
  protected:
-  Elements children_;
+  // Allocated from the active arena, like the nodes.
+  std::vector<Element, ArenaAllocator<Element>> children_;
   Requirement requirement_;
   Box box_;
+  int available_width_ = std::numeric_limits<int>::max();
 };
 
 void Render(Screen& screen, const Element& element);
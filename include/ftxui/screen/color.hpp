@@ -305,7 +305,15 @@ class Color {
   bool operator==(const Color& rhs) const;
   bool operator!=(const Color& rhs) const;
 
+  // An integer identifying the color. Equal colors have equal hashes.
+  uint32_t hash() const {
+    return uint32_t(type_) << 24 | uint32_t(red_) << 16 |  //
+           uint32_t(green_) << 8 | uint32_t(blue_);
+  }
+
   std::string Print(bool is_background_color) const;
+  // Same as Print, appending to |out| instead of allocating a new string.
+  void AppendTo(std::string& out, bool is_background_color) const;
 
  private:
   enum class ColorType : uint8_t {
@@ -0,0 +1,82 @@
+#ifndef FTXUI_SCREEN_GLYPH_HPP
+#define FTXUI_SCREEN_GLYPH_HPP
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <iosfwd>   // for ostream
+#include <string>   // for string
+#include <string_view>  // for string_view
+
+namespace ftxui {
+
+/// @brief The content of a single cell: a grapheme, stored on 32 bits.
+///
+/// The most common glyphs are made of a single codepoint. They are stored
+/// inline. The others, like the ones using combining characters, are interned
+/// into a table shared by the whole program, and referenced by index. Reading
+/// them back doesn't lock. The table is bounded: once full, new graphemes are
+/// reduced to their first codepoint.
+///
+/// A Glyph can be assigned from, compared with, and converted to a UTF-8
+/// encoded std::string.
+///
+/// The display width is computed once, when the glyph is built, and stored
+/// alongside. It never has to be measured again when printing the screen.
+/// @ingroup screen
+class Glyph {
+ public:
+  Glyph();  // A space.
+  Glyph(const char* str);         // NOLINT
+  Glyph(const std::string& str);  // NOLINT
+  static Glyph FromCodepoint(uint32_t codepoint);
+
+  // Return the codepoint when the glyph is made of a single one, 0 otherwise.
+  uint32_t codepoint() const;
+
+  // The UTF-8 representation:
+  std::string str() const;
+  operator std::string() const { return str(); }  // NOLINT
+  void AppendTo(std::string& out) const;
+
+  // The number of bytes of the UTF-8 representation.
+  size_t size() const;
+  bool empty() const;
+
+  // The number of cells used to display the glyph: 0, 1 or 2.
+  int width() const { return int((value_ & kWidthMask) >> kWidthShift); }
+
+  // An integer identifying the glyph. Equal glyphs have equal hashes.
+  uint32_t hash() const { return value_; }
+
+  friend bool operator==(const Glyph& a, const Glyph& b) {
+    return a.value_ == b.value_;
+  }
+  friend bool operator!=(const Glyph& a, const Glyph& b) {
+    return a.value_ != b.value_;
+  }
+
+ private:
+  // Layout of |value_|:
+  // - bit 31: Whether the glyph is interned.
+  // - bits 29-30: The width.
+  // - bits 0-28: The codepoint, or the index in the intern table.
+  static constexpr uint32_t kWidthShift = 29;
+  static constexpr uint32_t kWidthMask = 0x6000'0000;
+
+  explicit Glyph(uint32_t value) : value_(value) {}
+  static uint32_t Encode(std::string_view str);
+  bool IsInterned() const;
+  uint32_t payload() const;
+
+  uint32_t value_;
+};
+
+std::ostream& operator<<(std::ostream& out, const Glyph& glyph);
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_GLYPH_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
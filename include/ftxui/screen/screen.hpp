@@ -7,6 +7,7 @@
 
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/color.hpp"     // for Color, Color::Default
+#include "ftxui/screen/glyph.hpp"     // for Glyph
 #include "ftxui/screen/terminal.hpp"  // for Dimensions
 
 namespace ftxui {
@@ -18,7 +19,7 @@ struct Pixel {
 
   // The graphemes stored into the pixel. To support combining characters,
   // like: a⃦, this can potentially contains multiple codepoitns.
-  std::string character = " ";
+  Glyph character;
 
   // Colors:
   Color background_color = Color::Default;
@@ -62,13 +63,28 @@ class Screen {
   static Screen Create(Dimensions width, Dimensions height);
 
   // Node write into the screen using Screen::at.
-  std::string& at(int x, int y);
+  Glyph& at(int x, int y);
   Pixel& PixelAt(int x, int y);
+  // Same as PixelAt(), for callers registering with RegisterAutomerge() every
+  // cell where they set Pixel::automerge.
+  Pixel& PixelAtRegistered(int x, int y);
+
+  // Direct access to the dimx() contiguous pixels of a line. This ignores the
+  // stencil.
+  Pixel* LineAt(int y);
+  const Pixel* LineAt(int y) const;
 
   // Convert the screen into a printable string in the terminal.
   std::string ToString();
   void Print();
 
+  // Convert the difference with a previous Screen into a printable string.
+  std::string ToDiffString(const Screen& previous) const;
+
+  // Same as above, appending to a buffer that can be reused across frames.
+  void Encode(std::string& out) const;
+  void EncodeDiff(const Screen& previous, std::string& out) const;
+
   // Get screen dimensions.
   int dimx() const { return dimx_; }
   int dimy() const { return dimy_; }
@@ -79,6 +95,9 @@ class Screen {
   // Fill with space.
   void Clear();
 
+  // Register the cells whose Pixel::automerge is set. Only those are merged by
+  // ApplyShader(), unless a pixel was accessed with PixelAt().
+  void RegisterAutomerge(const Box& box);
   void ApplyShader();
 
   struct Cursor {
@@ -102,10 +121,17 @@ class Screen {
   Box stencil;
 
  protected:
+  void Resize(int dimx, int dimy);
+
   int dimx_;
   int dimy_;
-  std::vector<std::vector<Pixel>> pixels_;
+  // The pixels, line by line. The line |y| starts at index |y * dimx_|.
+  std::vector<Pixel> pixels_;
   Cursor cursor_;
+  std::vector<Box> automerge_boxes_;
+  // Whether PixelAt() was used, possibly to set Pixel::automerge outside of
+  // the registered boxes. ApplyShader() visits the whole screen then.
+  bool automerge_unregistered_ = false;
 };
 
 }  // namespace ftxui
@@ -18,6 +18,8 @@ int string_width(const std::string&);
 // Split the string into a its glyphs. An empty one is inserted ater fullwidth
 // ones.
 std::vector<std::string> Utf8ToGlyphs(const std::string& input);
+// Same, but reuses the capacity of |glyphs|.
+void Utf8ToGlyphs(const std::string& input, std::vector<std::string>* glyphs);
 // If |input| was an array of glyphs, this returns the number of char to eat
 // before reaching the glyph at index |glyph_index|.
 int GlyphPosition(const std::string& input,
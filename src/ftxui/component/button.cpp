@@ -137,7 +137,7 @@ Component Button(ConstStringRef label,
       SetAnimationTarget(1.F);       // NOLINT
     }
 
-    bool OnEvent(Event event) override {
+    bool OnEvent(const Event& event) override {
       if (event.is_mouse()) {
         return OnMouseEvent(event);
       }
@@ -149,12 +149,16 @@ Component Button(ConstStringRef label,
       return false;
     }
 
-    bool OnMouseEvent(Event event) {
+    bool OnMouseEvent(const Event& event) {
 
       if (event.screen_) {
-        mouse_hover_ = box_.Contain(event.mouse().x, event.mouse().y) &&
+        const bool mouse_hover = box_.Contain(event.mouse().x, event.mouse().y) &&
                        CaptureMouse(event) &&
                        (!event.screen_->GetCapturedComponent() || event.screen_->GetCapturedComponent() == this);
+        if (mouse_hover != mouse_hover_) {
+          mouse_hover_ = mouse_hover;
+          event.screen_->Invalidate();
+        }
 
         if (!mouse_hover_) {
           return false;
@@ -12,11 +12,11 @@ namespace ftxui {
 class CatchEventBase : public ComponentBase {
  public:
   // Constructor.
-  explicit CatchEventBase(std::function<bool(Event)> on_event)
+  explicit CatchEventBase(std::function<bool(const Event&)> on_event)
       : on_event_(std::move(on_event)) {}
 
   // Component implementation.
-  bool OnEvent(Event event) override {
+  bool OnEvent(const Event& event) override {
     if (on_event_(event)) {
       return true;
     } else {
@@ -25,7 +25,7 @@ class CatchEventBase : public ComponentBase {
   }
 
  protected:
-  std::function<bool(Event)> on_event_;
+  std::function<bool(const Event&)> on_event_;
 };
 
 /// @brief Return a component, using |on_event| to catch events. This function
@@ -51,7 +51,7 @@ class CatchEventBase : public ComponentBase {
 /// screen.Loop(component);
 /// ```
 Component CatchEvent(Component child,
-                     std::function<bool(Event event)> on_event) {
+                     std::function<bool(const Event& event)> on_event) {
   auto out = Make<CatchEventBase>(std::move(on_event));
   out->Add(std::move(child));
   return out;
@@ -76,11 +76,12 @@ Component CatchEvent(Component child,
 /// });
 /// screen.Loop(renderer);
 /// ```
-ComponentDecorator CatchEvent(std::function<bool(Event)> on_event) {
+ComponentDecorator CatchEvent(std::function<bool(const Event&)> on_event) {
   return [on_event = std::move(on_event)](Component child) {
-    return CatchEvent(std::move(child), [on_event = on_event](Event event) {
-      return on_event(std::move(event));
-    });
+    return CatchEvent(std::move(child),
+                      [on_event = on_event](const Event& event) {
+                        return on_event(event);
+                      });
   };
 }
 
@@ -7,6 +7,7 @@
 #include "ftxui/component/component_options.hpp"  // for CheckboxOption, EntryState
 #include "ftxui/component/event.hpp"              // for Event, Event::Return
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
 #include "ftxui/dom/elements.hpp"  // for operator|, Element, reflect, focus, nothing, select
 #include "ftxui/screen/box.hpp"  // for Box
 #include "ftxui/util/ref.hpp"    // for Ref, ConstStringRef
@@ -37,7 +38,7 @@ class CheckboxBase : public ComponentBase {
     return element | focus_management | reflect(box_);
   }
 
-  bool OnEvent(Event event) override {
+  bool OnEvent(const Event& event) override {
     if (!CaptureMouse(event)) {
       return false;
     }
@@ -46,7 +47,7 @@ class CheckboxBase : public ComponentBase {
       return OnMouseEvent(event);
     }
 
-    hovered_ = false;
+    SetHovered(event, false);
     if (event == Event::Character(' ') || event == Event::Return) {
       *state_ = !*state_;
       option_->on_change();
@@ -56,8 +57,8 @@ class CheckboxBase : public ComponentBase {
     return false;
   }
 
-  bool OnMouseEvent(Event event) {
-    hovered_ = box_.Contain(event.mouse().x, event.mouse().y);
+  bool OnMouseEvent(const Event& event) {
+    SetHovered(event, box_.Contain(event.mouse().x, event.mouse().y));
 
     if (!CaptureMouse(event)) {
       return false;
@@ -77,6 +78,13 @@ class CheckboxBase : public ComponentBase {
     return false;
   }
 
+  void SetHovered(const Event& event, bool hovered) {
+    if (hovered_ != hovered && event.screen_) {
+      event.screen_->Invalidate();
+    }
+    hovered_ = hovered;
+  }
+
   bool Focusable() const final { return true; }
 
   ConstStringRef label_;
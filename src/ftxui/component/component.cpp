@@ -100,7 +100,7 @@ Element ComponentBase::Render() {
 /// The default implementation called OnEvent on every child until one return
 /// true. If none returns true, return false.
 /// @ingroup component
-bool ComponentBase::OnEvent(Event event) {  // NOLINT
+bool ComponentBase::OnEvent(const Event& event) {  // NOLINT
     for (Component& child : children_) {      // NOLINT
         if (child->OnEvent(event)) {
           return true;
@@ -178,11 +178,19 @@ void ComponentBase::SetActiveChild(Component child) {  // NOLINT
 /// @brief Configure all the ancestors to give focus to this component.
 /// @ingroup component
 void ComponentBase::TakeFocus() {
+  bool changed = false;
   ComponentBase* child = this;
   while (ComponentBase* parent = child->parent_) {
+    changed |= !child->Active();
     parent->SetActiveChild(child);
     child = parent;
   }
+
+  // The focus is drawn. Event handlers may take it without reporting it.
+  ScreenInteractive* screen = ScreenInteractive::Active();
+  if (changed && screen) {
+    screen->Invalidate();
+  }
 }
 
 /// @brief Take the CapturedMouse if available. There is only one component of
@@ -1,11 +1,25 @@
 #include <utility>  // for move
 
 #include "ftxui/component/event.hpp"
-#include "ftxui/component/mouse.hpp"  // for Mouse
-#include "ftxui/screen/string.hpp"    // for to_wstring
+#include "ftxui/component/mouse.hpp"      // for Mouse
+#include "ftxui/screen/intern_table.hpp"  // for InternTable
+#include "ftxui/screen/string.hpp"        // for to_wstring
 
 namespace ftxui {
 
+namespace {
+const std::string kPasteBegin = "\x1B[200~";  // NOLINT
+const std::string kPasteEnd = "\x1B[201~";    // NOLINT
+
+// Only the predefined events, like Event::ArrowUp, are interned. They are
+// added while the constants below are initialized, before main(). Afterward,
+// the table is only read, without locking.
+InternTable& PredefinedEvents() {
+  static InternTable table(64, 1024);  // NOLINT
+  return table;
+}
+}  // namespace
+
 // static
 Event Event::Character(std::string input) {
   Event event;
@@ -37,6 +51,17 @@ Event Event::Mouse(std::string input, struct Mouse mouse) {
 Event Event::Special(std::string input) {
   Event event;
   event.input_ = std::move(input);
+  const uint32_t id = PredefinedEvents().Find(event.input_);
+  event.id_ = id == InternTable::kNotFound ? 0 : id + 1;
+  return event;
+}
+
+// static
+Event Event::Predefined(std::string input) {
+  Event event;
+  event.input_ = std::move(input);
+  const uint32_t id = PredefinedEvents().Intern(event.input_);
+  event.id_ = id == InternTable::kNotFound ? 0 : id + 1;
   return event;
 }
 
@@ -49,42 +74,58 @@ Event Event::CursorReporting(std::string input, int x, int y) {
   return event;
 }
 
+// static
+Event Event::Paste(std::string text) {
+  Event event;
+  event.input_ = kPasteBegin + std::move(text) + kPasteEnd;
+  event.type_ = Type::Paste;
+  return event;
+}
+
+std::string Event::paste() const {
+  if (!is_paste()) {
+    return "";
+  }
+  return input_.substr(kPasteBegin.size(),
+                       input_.size() - kPasteBegin.size() - kPasteEnd.size());
+}
+
 // --- Arrow ---
-const Event Event::ArrowLeft = Event::Special("\x1B[D");          // NOLINT
-const Event Event::ArrowRight = Event::Special("\x1B[C");         // NOLINT
-const Event Event::ArrowUp = Event::Special("\x1B[A");            // NOLINT
-const Event Event::ArrowDown = Event::Special("\x1B[B");          // NOLINT
-const Event Event::ArrowLeftCtrl = Event::Special("\x1B[1;5D");   // NOLINT
-const Event Event::ArrowRightCtrl = Event::Special("\x1B[1;5C");  // NOLINT
-const Event Event::ArrowUpCtrl = Event::Special("\x1B[1;5A");     // NOLINT
-const Event Event::ArrowDownCtrl = Event::Special("\x1B[1;5B");   // NOLINT
-const Event Event::Backspace = Event::Special({127});             // NOLINT
-const Event Event::Delete = Event::Special("\x1B[3~");            // NOLINT
-const Event Event::Escape = Event::Special("\x1B");               // NOLINT
-const Event Event::Return = Event::Special({10});                 // NOLINT
-const Event Event::Tab = Event::Special({9});                     // NOLINT
-const Event Event::TabReverse = Event::Special({27, 91, 90});     // NOLINT
+const Event Event::ArrowLeft = Event::Predefined("\x1B[D");          // NOLINT
+const Event Event::ArrowRight = Event::Predefined("\x1B[C");         // NOLINT
+const Event Event::ArrowUp = Event::Predefined("\x1B[A");            // NOLINT
+const Event Event::ArrowDown = Event::Predefined("\x1B[B");          // NOLINT
+const Event Event::ArrowLeftCtrl = Event::Predefined("\x1B[1;5D");   // NOLINT
+const Event Event::ArrowRightCtrl = Event::Predefined("\x1B[1;5C");  // NOLINT
+const Event Event::ArrowUpCtrl = Event::Predefined("\x1B[1;5A");     // NOLINT
+const Event Event::ArrowDownCtrl = Event::Predefined("\x1B[1;5B");   // NOLINT
+const Event Event::Backspace = Event::Predefined({127});             // NOLINT
+const Event Event::Delete = Event::Predefined("\x1B[3~");            // NOLINT
+const Event Event::Escape = Event::Predefined("\x1B");               // NOLINT
+const Event Event::Return = Event::Predefined({10});                 // NOLINT
+const Event Event::Tab = Event::Predefined({9});                     // NOLINT
+const Event Event::TabReverse = Event::Predefined({27, 91, 90});     // NOLINT
 
 // See https://invisible-island.net/xterm/xterm-function-keys.html
 // We follow xterm-new / vterm-xf86-v4 / mgt / screen
-const Event Event::F1 = Event::Special("\x1BOP");     // NOLINT
-const Event Event::F2 = Event::Special("\x1BOQ");     // NOLINT
-const Event Event::F3 = Event::Special("\x1BOR");     // NOLINT
-const Event Event::F4 = Event::Special("\x1BOS");     // NOLINT
-const Event Event::F5 = Event::Special("\x1B[15~");   // NOLINT
-const Event Event::F6 = Event::Special("\x1B[17~");   // NOLINT
-const Event Event::F7 = Event::Special("\x1B[18~");   // NOLINT
-const Event Event::F8 = Event::Special("\x1B[19~");   // NOLINT
-const Event Event::F9 = Event::Special("\x1B[20~");   // NOLINT
-const Event Event::F10 = Event::Special("\x1B[21~");  // NOLINT
-const Event Event::F11 = Event::Special("\x1B[23~");  // NOLINT
-const Event Event::F12 = Event::Special("\x1B[24~");  // NOLINT
-
-const Event Event::Home = Event::Special({27, 91, 72});           // NOLINT
-const Event Event::End = Event::Special({27, 91, 70});            // NOLINT
-const Event Event::PageUp = Event::Special({27, 91, 53, 126});    // NOLINT
-const Event Event::PageDown = Event::Special({27, 91, 54, 126});  // NOLINT
-const Event Event::Custom = Event::Special({0});                  // NOLINT
+const Event Event::F1 = Event::Predefined("\x1BOP");     // NOLINT
+const Event Event::F2 = Event::Predefined("\x1BOQ");     // NOLINT
+const Event Event::F3 = Event::Predefined("\x1BOR");     // NOLINT
+const Event Event::F4 = Event::Predefined("\x1BOS");     // NOLINT
+const Event Event::F5 = Event::Predefined("\x1B[15~");   // NOLINT
+const Event Event::F6 = Event::Predefined("\x1B[17~");   // NOLINT
+const Event Event::F7 = Event::Predefined("\x1B[18~");   // NOLINT
+const Event Event::F8 = Event::Predefined("\x1B[19~");   // NOLINT
+const Event Event::F9 = Event::Predefined("\x1B[20~");   // NOLINT
+const Event Event::F10 = Event::Predefined("\x1B[21~");  // NOLINT
+const Event Event::F11 = Event::Predefined("\x1B[23~");  // NOLINT
+const Event Event::F12 = Event::Predefined("\x1B[24~");  // NOLINT
+
+const Event Event::Home = Event::Predefined({27, 91, 72});           // NOLINT
+const Event Event::End = Event::Predefined({27, 91, 70});            // NOLINT
+const Event Event::PageUp = Event::Predefined({27, 91, 53, 126});    // NOLINT
+const Event Event::PageDown = Event::Predefined({27, 91, 54, 126});  // NOLINT
+const Event Event::Custom = Event::Predefined({0});                  // NOLINT
 
 }  // namespace ftxui
 
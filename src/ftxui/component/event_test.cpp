@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowUp, Event::ArrowDown, Event::Custom, Event::Return
+#include "ftxui/component/mouse.hpp"  // for Mouse
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(EventTest, SpecialEquality) {
+  EXPECT_EQ(Event::Special("\x1B[A"), Event::ArrowUp);
+  EXPECT_EQ(Event::Special(std::string({10})), Event::Return);
+  EXPECT_EQ(Event::Special(std::string({0})), Event::Custom);
+  EXPECT_NE(Event::Special("\x1B[A"), Event::ArrowDown);
+  EXPECT_NE(Event::ArrowUp, Event::ArrowDown);
+}
+
+TEST(EventTest, CharacterEquality) {
+  EXPECT_EQ(Event::Character('a'), Event::Character("a"));
+  EXPECT_NE(Event::Character('a'), Event::Character('b'));
+  EXPECT_NE(Event::Character('a'), Event::ArrowUp);
+
+  // Events are compared using their input, whatever their type.
+  EXPECT_EQ(Event::Character("\x1B[A"), Event::ArrowUp);
+}
+
+TEST(EventTest, LongSpecialEquality) {
+  const std::string reply = "\x1BP1+r536574756C6172=1B5B3F32303236686C\x1B\\";
+  EXPECT_EQ(Event::Special(reply), Event::Special(reply));
+  EXPECT_NE(Event::Special(reply), Event::Special(reply + "a"));
+  EXPECT_NE(Event::Special(reply), Event::ArrowUp);
+}
+
+TEST(EventTest, Mouse) {
+  Mouse mouse;
+  mouse.button = Mouse::Left;
+  mouse.motion = Mouse::Pressed;
+  mouse.x = 1;
+  mouse.y = 2;
+  const Event event = Event::Mouse("\x1B[<0;2;3M", mouse);
+  EXPECT_TRUE(event.is_mouse());
+  EXPECT_EQ(event.mouse().x, 1);
+  EXPECT_EQ(event.mouse().y, 2);
+  EXPECT_EQ(event, Event::Mouse("\x1B[<0;2;3M", mouse));
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
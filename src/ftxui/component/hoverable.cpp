@@ -51,10 +51,14 @@ Component Hoverable(Component component, bool* hover) {
       return ComponentBase::Render() | reflect(box_);
     }
 
-    bool OnEvent(Event event) override {
+    bool OnEvent(const Event& event) override {
       if (event.is_mouse()) {
-        *hover_ = box_.Contain(event.mouse().x, event.mouse().y) &&
-                  CaptureMouse(event);
+        const bool hover = box_.Contain(event.mouse().x, event.mouse().y) &&
+                           CaptureMouse(event);
+        if (hover != *hover_ && event.screen_) {
+          event.screen_->Invalidate();
+        }
+        *hover_ = hover;
       }
 
       return ComponentBase::OnEvent(event);
@@ -100,12 +104,15 @@ Component Hoverable(Component component,
       return ComponentBase::Render() | reflect(box_);
     }
 
-    bool OnEvent(Event event) override {
+    bool OnEvent(const Event& event) override {
       if (event.is_mouse()) {
         const bool hover = box_.Contain(event.mouse().x, event.mouse().y) &&
                            CaptureMouse(event);
         if (hover != hover_) {
           Post(hover ? on_enter_ : on_leave_);
+          if (event.screen_) {
+            event.screen_->Invalidate();
+          }
         }
         hover_ = hover;
       }
@@ -41,6 +41,27 @@ std::string PasswordField(size_t size) {
   return out;
 }
 
+std::string RemoveControlCharacters(const std::string& input) {
+  std::string out;
+  out.reserve(input.size());
+  for (size_t i = 0; i < input.size(); ++i) {
+    const auto byte = uint8_t(input[i]);
+    // C0 controls and DEL:
+    if (byte < 32 || byte == 127) {  // NOLINT
+      continue;
+    }
+    // C1 controls, encoded as U+0080 to U+009F:
+    if (byte == 0xC2 && i + 1 < input.size() &&  // NOLINT
+        uint8_t(input[i + 1]) >= 0x80 &&         // NOLINT
+        uint8_t(input[i + 1]) < 0xA0) {          // NOLINT
+      ++i;
+      continue;
+    }
+    out += input[i];
+  }
+  return out;
+}
+
 /// @brief An input box for editing text.
 /// @param content The editable content.
 /// @param placeholder The text displayed when content is still empty.
@@ -134,6 +134,67 @@ TEST(InputTest, Insert) {
   EXPECT_EQ(content, "-a--bc");
 }
 
+TEST(InputTest, Paste) {
+  std::string content;
+  std::string placeholder;
+  auto option = InputOption();
+  option.cursor_position = 0;
+  int on_change = 0;
+  option.on_change = [&] { on_change++; };
+  Component input = Input(&content, &placeholder, &option);
+
+  input->OnEvent(Event::Character('a'));
+  input->OnEvent(Event::Character('b'));
+  input->OnEvent(Event::ArrowLeft);
+  EXPECT_TRUE(input->OnEvent(Event::Paste("€ 12")));
+  EXPECT_EQ(content, "a€ 12b");
+  EXPECT_EQ(option.cursor_position(), 5);
+  EXPECT_EQ(on_change, 3);
+
+  EXPECT_FALSE(input->OnEvent(Event::Paste("")));
+  EXPECT_EQ(on_change, 3);
+}
+
+TEST(InputTest, PasteControlCharacters) {
+  std::string content;
+  std::string placeholder;
+  auto option = InputOption();
+  option.cursor_position = 0;
+  int on_enter = 0;
+  option.on_enter = [&] { on_enter++; };
+  Component input = Input(&content, &placeholder, &option);
+
+  EXPECT_TRUE(input->OnEvent(Event::Paste("a\nb\tc\r\x1B[Ad\x7F\xC2\x85" "e")));
+  EXPECT_EQ(content, "abc[Ade");
+  EXPECT_EQ(option.cursor_position(), 7);
+  EXPECT_EQ(on_enter, 0);
+
+  // Nothing left to insert.
+  EXPECT_FALSE(input->OnEvent(Event::Paste("\n\n")));
+  EXPECT_EQ(content, "abc[Ade");
+}
+
+TEST(InputTest, PasteCombining) {
+  std::string content;
+  std::string placeholder;
+  auto option = InputOption();
+  option.cursor_position = 0;
+  Component input = Input(&content, &placeholder, &option);
+
+  input->OnEvent(Event::Character('a'));
+  input->OnEvent(Event::Character('b'));
+  input->OnEvent(Event::ArrowLeft);
+
+  // The combining character merges into 'a'. The cursor stays before 'b'.
+  EXPECT_TRUE(input->OnEvent(Event::Paste("\xE2\x83\xA6")));
+  EXPECT_EQ(content, "a\xE2\x83\xA6" "b");
+  EXPECT_EQ(option.cursor_position(), 1);
+
+  EXPECT_TRUE(input->OnEvent(Event::Paste("\xE2\x83\xA6" "x")));
+  EXPECT_EQ(content, "a\xE2\x83\xA6\xE2\x83\xA6" "xb");
+  EXPECT_EQ(option.cursor_position(), 2);
+}
+
 TEST(InputTest, Home) {
   std::string content;
   std::string placeholder;
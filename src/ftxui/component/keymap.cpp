@@ -0,0 +1,147 @@
+#include <functional>        // for function
+#include <initializer_list>  // for initializer_list
+#include <memory>            // for make_shared, make_unique, shared_ptr
+#include <utility>           // for move
+#include <vector>            // for vector
+
+#include "ftxui/component/component.hpp"  // for CatchEvent, Keymap, ComponentDecorator
+#include "ftxui/component/component_base.hpp"  // for Component
+#include "ftxui/component/event.hpp"           // for Event, Event::Custom
+#include "ftxui/component/keymap.hpp"          // for KeyBindings
+
+namespace ftxui {
+
+namespace {
+
+// Only the keyboard is bound. The other events must not interrupt a chord.
+bool IsKey(const Event& event) {
+  return !event.is_mouse() && !event.is_cursor_reporting() &&
+         !event.is_paste() && event != Event::Custom;
+}
+
+}  // namespace
+
+KeyBindings::KeyBindings() : root_(std::make_shared<Node>()) {}
+
+/// @brief Bind a single event to an action.
+/// @param key The event triggering the action.
+/// @param action The action to execute.
+KeyBindings& KeyBindings::Bind(const Event& key, std::function<void()> action) {
+  return Bind(std::vector<Event>{key}, std::move(action));
+}
+
+/// @brief Bind a sequence of events, a chord, to an action.
+/// @param keys The events to receive in a row to trigger the action.
+/// @param action The action to execute.
+KeyBindings& KeyBindings::Bind(const std::vector<Event>& keys,
+                               std::function<void()> action) {
+  Node* node = root_.get();
+  for (const Event& key : keys) {
+    auto& next = node->next[key.input()];
+    if (!next) {
+      next = std::make_unique<Node>();
+    }
+    node = next.get();
+  }
+  node->action = std::move(action);
+  return *this;
+}
+
+/// @brief Bind a sequence of events, a chord, to an action.
+/// @param keys The events to receive in a row to trigger the action.
+/// @param action The action to execute.
+KeyBindings& KeyBindings::Bind(std::initializer_list<Event> keys,
+                               std::function<void()> action) {
+  return Bind(std::vector<Event>(keys), std::move(action));
+}
+
+/// @brief Return a component, executing the actions bound in |bindings| when
+/// their keys are received. The other events are forwarded to |child|.
+///
+/// The bindings apply only while the component is in the focus path, so
+/// nested Keymap define the bindings of each focus scope. The outer one is
+/// consulted first.
+/// @param child The wrapped component.
+/// @param bindings The table of key bindings.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::TerminalOutput();
+/// KeyBindings bindings;
+/// bindings.Bind(Event::Character('q'), screen.ExitLoopClosure());
+/// bindings.Bind({Event::Character('g'), Event::Character('g')},
+///               [&] { selected = 0; });
+/// auto component = Keymap(menu, bindings);
+/// screen.Loop(component);
+/// ```
+Component Keymap(Component child, KeyBindings bindings) {
+  // The node of the chord received so far. The root when there is none.
+  auto pending = std::make_shared<const KeyBindings::Node*>(nullptr);
+  return CatchEvent(std::move(child), [bindings = std::move(bindings),
+                                       pending](const Event& event) {
+    if (!IsKey(event)) {
+      return false;
+    }
+
+    const KeyBindings::Node* node = *pending;
+    *pending = nullptr;
+
+    // Continue the chord:
+    if (node) {
+      auto it = node->next.find(event.input());
+      if (it != node->next.end()) {
+        node = it->second.get();
+        if (node->next.empty()) {
+          node->action();
+        } else {
+          *pending = node;
+        }
+        return true;
+      }
+
+      // The chord is interrupted. Execute the binding of the keys received so
+      // far, if any, and start a new one.
+      if (node->action) {
+        node->action();
+      }
+    }
+
+    auto it = bindings.root().next.find(event.input());
+    if (it == bindings.root().next.end()) {
+      return false;
+    }
+    node = it->second.get();
+    if (node->next.empty()) {
+      node->action();
+    } else {
+      *pending = node;
+    }
+    return true;
+  });
+}
+
+/// @brief Decorate a component, executing the actions bound in |bindings| when
+/// their keys are received.
+/// @param bindings The table of key bindings.
+/// @ingroup component
+///
+/// ### Example
+///
+/// ```cpp
+/// KeyBindings bindings;
+/// bindings.Bind(Event::Character('q'), screen.ExitLoopClosure());
+/// component |= Keymap(bindings);
+/// ```
+ComponentDecorator Keymap(KeyBindings bindings) {
+  return [bindings = std::move(bindings)](Component child) {
+    return Keymap(std::move(child), bindings);
+  };
+}
+
+}  // namespace ftxui
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <string>  // for string
+
+#include "ftxui/component/component.hpp"       // for Keymap, Renderer, CatchEvent, Container
+#include "ftxui/component/component_base.hpp"  // for ComponentBase, Component
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowUp, Event::Custom
+#include "ftxui/component/keymap.hpp"  // for KeyBindings
+#include "ftxui/component/mouse.hpp"   // for Mouse
+#include "ftxui/dom/elements.hpp"      // for text
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+// A component recording the events it receives.
+Component Recorder(std::string* received) {
+  return CatchEvent(Renderer([](bool /*focused*/) { return text(""); }),
+                    [received](const Event& event) {
+                      *received += event.input();
+                      return true;
+                    });
+}
+}  // namespace
+
+TEST(KeymapTest, Basic) {
+  std::string log;
+  std::string received;
+  KeyBindings bindings;
+  bindings.Bind(Event::Character('a'), [&] { log += "a"; });
+  bindings.Bind(Event::ArrowUp, [&] { log += "up"; });
+  auto component = Keymap(Recorder(&received), bindings);
+
+  EXPECT_TRUE(component->OnEvent(Event::Character('a')));
+  EXPECT_TRUE(component->OnEvent(Event::Special("\x1B[A")));
+  EXPECT_TRUE(component->OnEvent(Event::Character('b')));
+  EXPECT_EQ(log, "aup");
+  EXPECT_EQ(received, "b");
+}
+
+TEST(KeymapTest, Chord) {
+  std::string log;
+  std::string received;
+  KeyBindings bindings;
+  bindings.Bind({Event::Character('g'), Event::Character('g')},
+                [&] { log += "[gg]"; });
+  bindings.Bind({Event::Character('g'), Event::Character('t')},
+                [&] { log += "[gt]"; });
+  auto component = Recorder(&received) | Keymap(bindings);
+
+  component->OnEvent(Event::Character('g'));
+  EXPECT_EQ(log, "");
+  component->OnEvent(Event::Character('g'));
+  EXPECT_EQ(log, "[gg]");
+  component->OnEvent(Event::Character('g'));
+  component->OnEvent(Event::Character('t'));
+  EXPECT_EQ(log, "[gg][gt]");
+  EXPECT_EQ(received, "");
+
+  // An interrupted chord is dropped. The event interrupting it is forwarded.
+  component->OnEvent(Event::Character('g'));
+  component->OnEvent(Event::Character('x'));
+  EXPECT_EQ(log, "[gg][gt]");
+  EXPECT_EQ(received, "x");
+}
+
+TEST(KeymapTest, PrefixBinding) {
+  std::string log;
+  std::string received;
+  KeyBindings bindings;
+  bindings.Bind(Event::Character('d'), [&] { log += "[d]"; });
+  bindings.Bind({Event::Character('d'), Event::Character('d')},
+                [&] { log += "[dd]"; });
+  auto component = Keymap(Recorder(&received), bindings);
+
+  component->OnEvent(Event::Character('d'));
+  component->OnEvent(Event::Character('d'));
+  EXPECT_EQ(log, "[dd]");
+
+  // 'd' is executed when the next event doesn't continue the chord.
+  component->OnEvent(Event::Character('d'));
+  EXPECT_EQ(log, "[dd]");
+  component->OnEvent(Event::Character('x'));
+  EXPECT_EQ(log, "[dd][d]");
+  EXPECT_EQ(received, "x");
+}
+
+TEST(KeymapTest, NonKeyEventsDoNotInterruptChords) {
+  std::string log;
+  std::string received;
+  KeyBindings bindings;
+  bindings.Bind({Event::Character('g'), Event::Character('g')},
+                [&] { log += "[gg]"; });
+  auto component = Keymap(Recorder(&received), bindings);
+
+  Mouse mouse;
+  mouse.button = Mouse::None;
+  mouse.motion = Mouse::Pressed;
+  component->OnEvent(Event::Character('g'));
+  component->OnEvent(Event::Mouse("", mouse));
+  component->OnEvent(Event::Custom);
+  component->OnEvent(Event::Character('g'));
+  EXPECT_EQ(log, "[gg]");
+}
+
+TEST(KeymapTest, FocusScope) {
+  std::string log;
+  KeyBindings outer;
+  outer.Bind(Event::Character('q'), [&] { log += "[outer q]"; });
+  KeyBindings left;
+  left.Bind(Event::Character('x'), [&] { log += "[left x]"; });
+  KeyBindings right;
+  right.Bind(Event::Character('x'), [&] { log += "[right x]"; });
+
+  std::string left_received;
+  std::string right_received;
+  int selected = 0;
+  auto component = Container::Horizontal(
+                       {
+                           Keymap(Recorder(&left_received), left),
+                           Keymap(Recorder(&right_received), right),
+                       },
+                       &selected) |
+                   Keymap(outer);
+
+  component->OnEvent(Event::Character('x'));
+  component->OnEvent(Event::Character('q'));
+  selected = 1;
+  component->OnEvent(Event::Character('x'));
+  EXPECT_EQ(log, "[left x][outer q][right x]");
+}
+
+TEST(KeymapTest, BindAfterCreation) {
+  std::string log;
+  std::string received;
+  KeyBindings bindings;
+  auto component = Keymap(Recorder(&received), bindings);
+  bindings.Bind(Event::Character('a'), [&] { log += "a"; });
+  component->OnEvent(Event::Character('a'));
+  EXPECT_EQ(log, "a");
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
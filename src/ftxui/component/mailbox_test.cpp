@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <string>  // for string
+#include <thread>  // for thread
+#include <utility>  // for pair
+#include <vector>  // for vector
+
+#include "ftxui/component/mailbox.hpp"
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(Mailbox, Basic) {
+  auto mailbox = MakeMailbox<std::string, int>();
+  std::vector<int> values;
+  EXPECT_FALSE(mailbox->HasPending());
+  EXPECT_FALSE(mailbox->ReceiveAll(&values));
+
+  EXPECT_TRUE(mailbox->Send("a", 1));
+  EXPECT_FALSE(mailbox->Send("b", 2));
+  EXPECT_FALSE(mailbox->Send("a", 3));
+  EXPECT_TRUE(mailbox->HasPending());
+
+  EXPECT_TRUE(mailbox->ReceiveAll(&values));
+  EXPECT_EQ(values, std::vector<int>({3, 2}));
+  EXPECT_FALSE(mailbox->HasPending());
+
+  // Keys received are forgotten.
+  EXPECT_TRUE(mailbox->Send("b", 4));
+  EXPECT_TRUE(mailbox->ReceiveAll(&values));
+  EXPECT_EQ(values, std::vector<int>({3, 2, 4}));
+}
+
+TEST(Mailbox, LatestValueWithThreads) {
+  const int keys = 4;
+  const int values = 10000;
+  auto mailbox = MakeMailbox<int, std::pair<int, int>>();
+  std::vector<std::thread> threads;
+  for (int key = 0; key < keys; ++key) {
+    threads.emplace_back([&, key] {
+      for (int value = 1; value <= values; ++value)
+        mailbox->Send(key, {key, value});
+    });
+  }
+
+  // At most one value per key is received at once, and the values of a key are
+  // received in the order they were sent.
+  std::vector<int> latest(keys, 0);
+  auto receive = [&] {
+    std::vector<std::pair<int, int>> batch;
+    mailbox->ReceiveAll(&batch);
+    EXPECT_LE(batch.size(), size_t(keys));
+    for (auto [key, value] : batch) {
+      EXPECT_GT(value, latest[key]);
+      latest[key] = value;
+    }
+  };
+  for (int i = 0; i < 1000; ++i)
+    receive();
+  for (auto& thread : threads)
+    thread.join();
+  receive();
+
+  EXPECT_EQ(latest, std::vector<int>(keys, values));
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -234,7 +234,7 @@ class MenuBase : public ComponentBase {
   }
 
   // NOLINTNEXTLINE(readability-function-cognitive-complexity)
-  bool OnEvent(Event event) override {
+  bool OnEvent(const Event& event) override {
     Clamp();
     if (!CaptureMouse(event)) {
       return false;
@@ -295,7 +295,7 @@ class MenuBase : public ComponentBase {
     return false;
   }
 
-  bool OnMouseEvent(Event event) {
+  bool OnMouseEvent(const Event& event) {
     if (event.mouse().button == Mouse::WheelDown ||
         event.mouse().button == Mouse::WheelUp) {
       return OnMouseWheel(event);
@@ -314,6 +314,9 @@ class MenuBase : public ComponentBase {
       }
 
       TakeFocus();
+      if (focused_entry() != i && event.screen_) {
+        event.screen_->Invalidate();
+      }
       focused_entry() = i;
       if (event.mouse().button == Mouse::Left &&
           event.mouse().motion == Mouse::Released) {
@@ -328,7 +331,7 @@ class MenuBase : public ComponentBase {
     return false;
   }
 
-  bool OnMouseWheel(Event event) {
+  bool OnMouseWheel(const Event& event) {
     if (!box_.Contain(event.mouse().x, event.mouse().y)) {
       return false;
     }
@@ -611,12 +614,16 @@ Component MenuEntry(ConstStringRef label, Ref<MenuEntryOption> option) {
     }
 
     bool Focusable() const override { return true; }
-    bool OnEvent(Event event) override {
+    bool OnEvent(const Event& event) override {
       if (!event.is_mouse()) {
         return false;
       }
 
-      hovered_ = box_.Contain(event.mouse().x, event.mouse().y);
+      const bool hovered = box_.Contain(event.mouse().x, event.mouse().y);
+      if (hovered != hovered_ && event.screen_) {
+        event.screen_->Invalidate();
+      }
+      hovered_ = hovered;
 
       if (!hovered_) {
         return false;
@@ -59,7 +59,7 @@ TEST(MenuTest, DirectionDown) {
   Screen screen(4, 3);
   Render(screen, menu->Render());
   EXPECT_EQ(screen.ToString(),
-            "\x1B[1m\x1B[7m> 1 \x1B[22m\x1B[27m\r\n"
+            "\x1B[1;7m> 1 \x1B[0m\r\n"
             "  2 \r\n"
             "  3 ");
 
@@ -88,7 +88,7 @@ TEST(MenuTest, DirectionsUp) {
   EXPECT_EQ(screen.ToString(),
             "  3 \r\n"
             "  2 \r\n"
-            "\x1B[1m\x1B[7m> 1 \x1B[22m\x1B[27m");
+            "\x1B[1;7m> 1 \x1B[0m");
   menu->OnEvent(Event::ArrowDown);
   EXPECT_EQ(selected, 0);
   menu->OnEvent(Event::ArrowUp);
@@ -112,7 +112,7 @@ TEST(MenuTest, DirectionsRight) {
   Screen screen(10, 1);
   Render(screen, menu->Render());
   EXPECT_EQ(screen.ToString(),
-            "\x1B[1m\x1B[7m> 1\x1B[22m\x1B[27m"
+            "\x1B[1;7m> 1\x1B[0m"
             "  2"
             "  3 ");
   menu->OnEvent(Event::ArrowLeft);
@@ -140,7 +140,7 @@ TEST(MenuTest, DirectionsLeft) {
   EXPECT_EQ(screen.ToString(),
             "  3"
             "  2"
-            "\x1B[1m\x1B[7m> 1\x1B[22m\x1B[27m ");
+            "\x1B[1;7m> 1\x1B[0m ");
   menu->OnEvent(Event::ArrowRight);
   EXPECT_EQ(selected, 0);
   menu->OnEvent(Event::ArrowLeft);
@@ -165,9 +165,9 @@ TEST(MenuTest, AnimationsHorizontal) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[1m\x1B[7m1\x1B[22m\x1B[27m \x1B[2m2\x1B[22m "
-        "\r\n\x1B[97m\x1B[49m\xE2\x94\x80\x1B[90m\x1B["
-        "49m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[39m\x1B[49m\r\n    ");
+        "\x1B[1;7m1\x1B[0m \x1B[2m2\x1B[0m "
+        "\r\n\x1B[97m\xE2\x94\x80\x1B[90m"
+        "\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[0m\r\n    ");
   }
   selected = 1;
   {
@@ -175,9 +175,9 @@ TEST(MenuTest, AnimationsHorizontal) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[7m1\x1B[27m \x1B[1m2\x1B[22m "
-        "\r\n\x1B[97m\x1B[49m\xE2\x94\x80\x1B[90m\x1B["
-        "49m\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[39m\x1B[49m\r\n    ");
+        "\x1B[7m1\x1B[0m \x1B[1m2\x1B[0m "
+        "\r\n\x1B[97m\xE2\x94\x80\x1B[90m"
+        "\xE2\x95\xB6\xE2\x94\x80\xE2\x94\x80\x1B[0m\r\n    ");
   }
   animation::Params params(2s);
   menu->OnAnimation(params);
@@ -186,9 +186,9 @@ TEST(MenuTest, AnimationsHorizontal) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[7m1\x1B[27m \x1B[1m2\x1B[22m "
-        "\r\n\x1B[90m\x1B[49m\xE2\x94\x80\xE2\x95\xB4\x1B[97m\x1B["
-        "49m\xE2\x94\x80\x1B[90m\x1B[49m\xE2\x95\xB6\x1B[39m\x1B[49m\r\n    ");
+        "\x1B[7m1\x1B[0m \x1B[1m2\x1B[0m "
+        "\r\n\x1B[90m\xE2\x94\x80\xE2\x95\xB4\x1B[97m"
+        "\xE2\x94\x80\x1B[90m\xE2\x95\xB6\x1B[0m\r\n    ");
   }
 }
 
@@ -202,11 +202,9 @@ TEST(MenuTest, AnimationsVertical) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[90m\x1B[49m\xE2\x94\x82\x1B[1m\x1B[7m\x1B[39m\x1B[49m1\x1B["
-        "22m\x1B[27m        "
-        "\r\n\x1B[97m\x1B[49m\xE2\x95\xB7\x1B[2m\x1B[39m\x1B[49m2\x1B[22m      "
-        "  \r\n\x1B[97m\x1B[49m\xE2\x94\x82\x1B[2m\x1B[39m\x1B[49m3\x1B[22m    "
-        "    ");
+        "\x1B[90m\xE2\x94\x82\x1B[0;1;7m1\x1B[0m        "
+        "\r\n\x1B[97m\xE2\x95\xB7\x1B[0;2m2\x1B[0m        "
+        "\r\n\x1B[97m\xE2\x94\x82\x1B[0;2m3\x1B[0m        ");
   }
   selected = 1;
   {
@@ -214,10 +212,9 @@ TEST(MenuTest, AnimationsVertical) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[90m\x1B[49m\xE2\x94\x82\x1B[7m\x1B[39m\x1B[49m1\x1B[27m        "
-        "\r\n\x1B[97m\x1B[49m\xE2\x95\xB7\x1B[1m\x1B[39m\x1B[49m2\x1B[22m      "
-        "  \r\n\x1B[97m\x1B[49m\xE2\x94\x82\x1B[2m\x1B[39m\x1B[49m3\x1B[22m    "
-        "    ");
+        "\x1B[90m\xE2\x94\x82\x1B[0;7m1\x1B[0m        "
+        "\r\n\x1B[97m\xE2\x95\xB7\x1B[0;1m2\x1B[0m        "
+        "\r\n\x1B[97m\xE2\x94\x82\x1B[0;2m3\x1B[0m        ");
   }
   animation::Params params(2s);
   menu->OnAnimation(params);
@@ -226,10 +223,9 @@ TEST(MenuTest, AnimationsVertical) {
     Render(screen, menu->Render());
     EXPECT_EQ(
         screen.ToString(),
-        "\x1B[97m\x1B[49m\xE2\x95\xB5\x1B[7m\x1B[39m\x1B[49m1\x1B[27m        "
-        "\r\n\x1B[90m\x1B[49m\xE2\x94\x82\x1B[1m\x1B[39m\x1B[49m2\x1B[22m      "
-        "  \r\n\x1B[97m\x1B[49m\xE2\x95\xB7\x1B[2m\x1B[39m\x1B[49m3\x1B[22m    "
-        "    ");
+        "\x1B[97m\xE2\x95\xB5\x1B[0;7m1\x1B[0m        "
+        "\r\n\x1B[90m\xE2\x94\x82\x1B[0;1m2\x1B[0m        "
+        "\r\n\x1B[97m\xE2\x95\xB7\x1B[0;2m3\x1B[0m        ");
   }
 }
 
@@ -55,7 +55,7 @@ class RadioboxBase : public ComponentBase {
   }
 
   // NOLINTNEXTLINE(readability-function-cognitive-complexity)
-  bool OnEvent(Event event) override {
+  bool OnEvent(const Event& event) override {
     Clamp();
     if (!CaptureMouse(event)) {
       return false;
@@ -110,7 +110,7 @@ class RadioboxBase : public ComponentBase {
     return false;
   }
 
-  bool OnMouseEvent(Event event) {
+  bool OnMouseEvent(const Event& event) {
     if (event.mouse().button == Mouse::WheelDown ||
         event.mouse().button == Mouse::WheelUp) {
       return OnMouseWheel(event);
@@ -122,6 +122,9 @@ class RadioboxBase : public ComponentBase {
       }
 
       TakeFocus();
+      if (focused_entry() != i && event.screen_) {
+        event.screen_->Invalidate();
+      }
       focused_entry() = i;
       if (event.mouse().button == Mouse::Left &&
           event.mouse().motion == Mouse::Released) {
@@ -136,7 +139,7 @@ class RadioboxBase : public ComponentBase {
     return false;
   }
 
-  bool OnMouseWheel(Event event) {
+  bool OnMouseWheel(const Event& event) {
     if (!box_.Contain(event.mouse().x, event.mouse().y)) {
       return false;
     }
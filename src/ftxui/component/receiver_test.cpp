@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <thread>   // for thread
 #include <utility>  // for move
+#include <vector>   // for vector
 
 #include "ftxui/component/receiver.hpp"
 
@@ -74,6 +75,54 @@ TEST(Receiver, BasicWithThread) {
   t23.join();
 }
 
+TEST(Receiver, ReceiveAll) {
+  auto receiver = MakeReceiver<char>();
+  auto sender = receiver->MakeSender();
+
+  std::vector<char> received;
+  EXPECT_FALSE(receiver->ReceiveAll(&received));
+
+  sender->Send('a');
+  sender->Send('b');
+  char c;
+  EXPECT_TRUE(receiver->ReceiveNonBlocking(&c));
+  EXPECT_EQ(c, 'a');
+  sender->Send('c');
+  sender->Send('d');
+
+  EXPECT_TRUE(receiver->ReceiveAll(&received));
+  EXPECT_EQ(received, std::vector<char>({'b', 'c', 'd'}));
+  EXPECT_FALSE(receiver->HasPending());
+  EXPECT_FALSE(receiver->ReceiveAll(&received));
+  EXPECT_EQ(received.size(), 3u);
+}
+
+// Items from every producer are received, in the order each one sent them.
+TEST(Receiver, ManyProducers) {
+  const int producers = 4;
+  const int items = 10000;
+  auto receiver = MakeReceiver<std::pair<int, int>>();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < producers; ++i) {
+    threads.emplace_back([i, sender = receiver->MakeSender()] {
+      for (int j = 0; j < items; ++j)
+        sender->Send({i, j});
+    });
+  }
+
+  std::vector<int> next(producers, 0);
+  std::pair<int, int> item;
+  while (receiver->Receive(&item)) {
+    EXPECT_EQ(item.second, next[item.first]);
+    next[item.first] = item.second + 1;
+  }
+  for (int i = 0; i < producers; ++i)
+    EXPECT_EQ(next[i], items);
+
+  for (auto& thread : threads)
+    thread.join();
+}
+
 }  // namespace ftxui
 // NOLINTEND
 
@@ -1,6 +1,8 @@
 #include <algorithm>  // for copy, max, min
 #include <array>      // for array
+#include <cerrno>     // for errno, EAGAIN, EINTR, EWOULDBLOCK
 #include <chrono>  // for operator-, milliseconds, operator>=, duration, common_type<>::type, time_point
+#include <condition_variable>  // for condition_variable
 #include <csignal>  // for signal, SIGTSTP, SIGABRT, SIGWINCH, raise, SIGFPE, SIGILL, SIGINT, SIGSEGV, SIGTERM, __sighandler_t, size_t
 #include <cstdio>   // for fileno, stdin
 #include <ftxui/component/task.hpp>  // for Task, Closure, AnimationTask
@@ -8,8 +10,9 @@
 #include <functional>        // for function
 #include <initializer_list>  // for initializer_list
 #include <iostream>  // for cout, ostream, operator<<, basic_ostream, endl, flush
+#include <mutex>     // for mutex, lock_guard, unique_lock
 #include <stack>     // for stack
-#include <thread>    // for thread, sleep_for
+#include <thread>    // for thread
 #include <tuple>     // for _Swallow_assign, ignore
 #include <type_traits>  // for decay_t
 #include <utility>      // for move, swap
@@ -24,9 +27,11 @@
 #include "ftxui/component/receiver.hpp"  // for ReceiverImpl, Sender, MakeReceiver, SenderImpl, Receiver
 #include "ftxui/component/screen_interactive.hpp"
 #include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
+#include "ftxui/dom/arena.hpp"                        // for Arena, ArenaScope
 #include "ftxui/dom/node.hpp"                         // for Node, Render
 #include "ftxui/dom/requirement.hpp"                  // for Requirement
 #include "ftxui/screen/terminal.hpp"                  // for Dimensions, Size
+#include "ftxui/screen/util.hpp"                      // for AppendDecimal
 
 #if defined(_WIN32)
 #define DEFINE_CONSOLEV2_PROPERTIES
@@ -39,9 +44,11 @@
 #error Must be compiled in UNICODE mode
 #endif
 #else
+#include <fcntl.h>  // for fcntl, open, F_GETFL, F_SETFL, O_NONBLOCK, O_WRONLY, O_NOCTTY, O_CLOEXEC
+#include <poll.h>        // for poll, pollfd, POLLIN, POLLOUT, POLLNVAL
 #include <sys/select.h>  // for select, FD_ISSET, FD_SET, FD_ZERO, fd_set, timeval
 #include <termios.h>  // for tcsetattr, termios, tcgetattr, TCSANOW, cc_t, ECHO, ICANON, VMIN, VTIME
-#include <unistd.h>  // for STDIN_FILENO, read
+#include <unistd.h>  // for STDIN_FILENO, STDOUT_FILENO, read, write, close, isatty, ttyname_r
 #endif
 
 // Quick exit is missing in standard CLang headers
@@ -64,18 +71,61 @@ namespace {
 
 ScreenInteractive* g_active_screen = nullptr;  // NOLINT
 
-void Flush() {
-  // Emscripten doesn't implement flush. We interpret zero as flush.
-  std::cout << '\0' << std::flush;
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+// Self-pipe waking up the EventListener when a signal is received, or when the
+// screen quits. It lives as long as the program.
+std::array<int, 2> g_wake_pipe = {-1, -1};  // NOLINT
+
+void CreateWakePipe() {
+  if (g_wake_pipe[0] >= 0 || pipe(g_wake_pipe.data()) != 0) {
+    return;
+  }
+  for (const int fd : g_wake_pipe) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);  // NOLINT
+    fcntl(fd, F_SETFD, FD_CLOEXEC);                          // NOLINT
+  }
+}
+
+void DrainWakePipe() {
+  std::array<char, 64> buffer;  // NOLINT
+  while (read(g_wake_pipe[0], buffer.data(), buffer.size()) > 0) {
+  }
+}
+
+// Open the terminal of stdout again, without blocking. A new file description
+// is created, so stdin, stderr and std::cout sharing the original one keep
+// blocking. Return STDOUT_FILENO when stdout isn't a terminal.
+int OpenOutput() {
+  std::array<char, 256> name;  // NOLINT
+  if (!isatty(STDOUT_FILENO) ||
+      ttyname_r(STDOUT_FILENO, name.data(), name.size()) != 0) {
+    return STDOUT_FILENO;
+  }
+  const int fd =
+      open(name.data(), O_WRONLY | O_NONBLOCK | O_NOCTTY | O_CLOEXEC);  // NOLINT
+  return fd >= 0 ? fd : STDOUT_FILENO;
+}
+#endif
+
+// Async signal safe function
+void Wake() {
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  if (g_wake_pipe[1] >= 0) {
+    const char c = 0;
+    std::ignore = write(g_wake_pipe[1], &c, 1);
+  }
+#endif
 }
 
 constexpr int timeout_milliseconds = 20;
-constexpr int timeout_microseconds = timeout_milliseconds * 1000;
 #if defined(_WIN32)
 
-void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
+void EventListener(std::atomic<bool>* quit,
+                   Sender<Task> out,
+                   int escape_timeout) {
   auto console = GetStdHandle(STD_INPUT_HANDLE);
   auto parser = TerminalInputParser(out->Clone());
+  parser.SetEscapeTimeout(escape_timeout);
   while (!*quit) {
     // Throttle ReadConsoleInput by waiting 250ms, this wait function will
     // return if there is input in the console.
@@ -106,9 +156,8 @@ void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
             continue;
           std::wstring wstring;
           wstring += key_event.uChar.UnicodeChar;
-          for (auto it : to_string(wstring)) {
-            parser.Add(it);
-          }
+          const std::string str = to_string(wstring);
+          parser.Add(str.data(), str.size());
         } break;
         case WINDOW_BUFFER_SIZE_EVENT:
           out->Send(Event::Special({0}));
@@ -127,9 +176,11 @@ void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
 #include <emscripten.h>
 
 // Read char from the terminal.
-void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
-  (void)timeout_microseconds;
+void EventListener(std::atomic<bool>* quit,
+                   Sender<Task> out,
+                   int escape_timeout) {
   auto parser = TerminalInputParser(std::move(out));
+  parser.SetEscapeTimeout(escape_timeout);
 
   char c;
   while (!*quit) {
@@ -154,30 +205,63 @@ void ftxui_on_resize(int columns, int rows) {
 
 #else  // POSIX (Linux & Mac)
 
-int CheckStdinReady(int usec_timeout) {
-  timeval tv = {0, usec_timeout};
-  fd_set fds;
-  FD_ZERO(&fds);                                          // NOLINT
-  FD_SET(STDIN_FILENO, &fds);                             // NOLINT
-  select(STDIN_FILENO + 1, &fds, nullptr, nullptr, &tv);  // NOLINT
-  return FD_ISSET(STDIN_FILENO, &fds);                    // NOLINT
-}
-
-// Read char from the terminal.
-void EventListener(std::atomic<bool>* quit, Sender<Task> out) {
-  auto parser = TerminalInputParser(std::move(out));
+// Read char from the terminal. This sleeps until there is some input, or until
+// woken up by Wake(). A timeout is only used to terminate an incomplete escape
+// sequence, exactly when it expires.
+void EventListener(std::atomic<bool>* quit,
+                   Sender<Task> out,
+                   int escape_timeout) {
+  auto parser = TerminalInputParser(out->Clone());
+  parser.SetEscapeTimeout(escape_timeout);
 
   while (!*quit) {
-    if (!CheckStdinReady(timeout_microseconds)) {
-      parser.Timeout(timeout_milliseconds);
+    // Without the wake pipe, fallback to polling |quit|.
+    const bool wake_pipe = g_wake_pipe[0] >= 0;
+    fd_set fds;
+    FD_ZERO(&fds);               // NOLINT
+    FD_SET(STDIN_FILENO, &fds);  // NOLINT
+    if (wake_pipe) {
+      FD_SET(g_wake_pipe[0], &fds);  // NOLINT
+    }
+    int timeout = parser.HasPending() ? parser.TimeoutRemaining()
+                                      : timeout_milliseconds;
+    if (!wake_pipe) {
+      timeout = std::min(timeout, timeout_milliseconds);
+    }
+    timeval tv = {timeout / 1000, (timeout % 1000) * 1000};  // NOLINT
+    const int max_fd = std::max(STDIN_FILENO, g_wake_pipe[0]);
+    const bool sleep = wake_pipe && !parser.HasPending();
+    const auto start = std::chrono::steady_clock::now();
+    const int ready =
+        select(max_fd + 1, &fds, nullptr, nullptr, sleep ? nullptr : &tv);
+    if (ready < 0) {
+      continue;
+    }
+
+    if (ready == 0) {
+      const auto elapsed = std::chrono::ceil<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start);
+      parser.Timeout(std::max(timeout, int(elapsed.count())));
+      continue;
+    }
+
+    // A signal was received. Wake up the loop, so that it handles it.
+    if (wake_pipe && FD_ISSET(g_wake_pipe[0], &fds)) {  // NOLINT
+      DrainWakePipe();
+      if (!*quit) {
+        out->Send([] {});
+      }
+    }
+
+    if (!FD_ISSET(STDIN_FILENO, &fds)) {  // NOLINT
       continue;
     }
 
-    const size_t buffer_size = 100;
-    std::array<char, buffer_size> buffer;                        // NOLINT;
-    size_t l = read(fileno(stdin), buffer.data(), buffer_size);  // NOLINT
-    for (size_t i = 0; i < l; ++i) {
-      parser.Add(buffer[i]);  // NOLINT
+    const size_t buffer_size = 4096;
+    std::array<char, buffer_size> buffer;                         // NOLINT;
+    ssize_t l = read(fileno(stdin), buffer.data(), buffer_size);  // NOLINT
+    if (l > 0) {
+      parser.Add(buffer.data(), size_t(l));
     }
   }
 }
@@ -222,6 +306,7 @@ void RecordSignal(int signal) {
     default:
       break;
   }
+  Wake();
 }
 
 void ExecuteSignalHandlers() {
@@ -268,6 +353,7 @@ enum class DECMode {
   kMouseUrxvtMode = 1015,
   kMouseSgrPixelsMode = 1016,
   kAlternateScreen = 1049,
+  kBracketedPaste = 2004,
 };
 
 // Device Status Report (DSR) {
@@ -303,6 +389,13 @@ std::string DeviceStatusReport(DSRMode ps) {
   return CSI + std::to_string(int(ps)) + "n";
 }
 
+// Append the sequence CSI |n| |final_byte|, like a cursor movement.
+void AppendCursorMove(std::string& out, int n, char final_byte) {
+  out += CSI;
+  util::AppendDecimal(out, n);
+  out += final_byte;
+}
+
 class CapturedMouseImpl : public CapturedMouseInterface {
  public:
   explicit CapturedMouseImpl(std::function<void(void)> callback)
@@ -317,13 +410,11 @@ class CapturedMouseImpl : public CapturedMouseInterface {
   std::function<void(void)> callback_;
 };
 
-void AnimationListener(std::atomic<bool>* quit, Sender<Task> out) {
-  // Animation at around 60fps.
-  const auto time_delta = std::chrono::milliseconds(15);
-  while (!*quit) {
-    out->Send(AnimationTask());
-    std::this_thread::sleep_for(time_delta);
-  }
+// Whether |b| is the same mouse action as |a|, at another position: the same
+// buttons and modifiers held.
+bool SameMouseAction(const Mouse& a, const Mouse& b) {
+  return a.button == b.button && a.motion == b.motion && a.shift == b.shift &&
+         a.meta == b.meta && a.control == b.control;
 }
 
 }  // namespace
@@ -334,8 +425,10 @@ ScreenInteractive::ScreenInteractive(int dimx,
                                      bool use_alternative_screen)
     : Screen(dimx, dimy),
       dimension_(dimension),
-      use_alternative_screen_(use_alternative_screen) {
+      use_alternative_screen_(use_alternative_screen),
+      previous_frame_(0, 0) {
   task_receiver_ = MakeReceiver<Task>();
+  mailbox_ = MakeMailbox<std::string, Closure>();
 }
 
 // static
@@ -386,12 +479,35 @@ void ScreenInteractive::Post(Task task) {
   }
 
   task_sender_->Send(std::move(task));
+
+  // The loop may be sleeping in poll().
+  if (reactor_waiting_) {
+    Wake();
+  }
 }
 
 void ScreenInteractive::PostEvent(Event event) {
   Post(event);
 }
 
+/// @brief Post a closure, executed once before drawing the next frame. It
+/// replaces the closure posted before with the same |key|, if not executed yet.
+///
+/// This is meant for updates produced faster than frames are drawn, like
+/// telemetry. Only the latest one of each key is executed, and the frame is
+/// drawn again.
+void ScreenInteractive::PostLatest(const std::string& key, Closure closure) {
+  // Closures sent toward inactive screen are dropped, like the tasks.
+  if (!task_sender_) {
+    return;
+  }
+
+  // Wake up the loop only for the first closure of a frame.
+  if (mailbox_->Send(key, std::move(closure))) {
+    Post([] {});
+  }
+}
+
 void ScreenInteractive::RequestAnimationFrame() {
   if (animation_requested_) {
     return;
@@ -402,6 +518,107 @@ void ScreenInteractive::RequestAnimationFrame() {
   if (now - previous_animation_time_ >= time_histeresis) {
     previous_animation_time_ = now;
   }
+  ArmFrameTimer();
+}
+
+/// @brief Draw a new frame, because the state of the components changed in a
+/// way not reported by an event handler returning true. This must be called
+/// from the thread running the loop. Other threads can use PostEvent(Event::Custom).
+void ScreenInteractive::Invalidate() {
+  frame_valid_ = false;
+}
+
+/// @brief Run the loop on a single thread. Instead of using threads to read the
+/// terminal and to schedule the animations, the loop waits with poll() for the
+/// terminal input, the tasks posted, the signals, the next animation frame, and
+/// the file descriptors registered with WatchFileDescriptor(). A loop driven
+/// with Loop::RunOnce() checks them without waiting.
+///
+/// This must be set before starting the loop. POSIX only, ignored elsewhere.
+/// @param enabled Whether to use the reactor mode. Default is false.
+void ScreenInteractive::SetReactorMode(bool enabled) {
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  reactor_mode_ = enabled;
+#else
+  (void)enabled;
+#endif
+}
+
+/// @brief Call |on_readable| from the loop, each time |fd| is readable, or
+/// closed. This requires the reactor mode, see SetReactorMode(). The callback
+/// must consume the data, and call Invalidate() to draw a new frame if needed.
+/// On end of file or error, it must call UnwatchFileDescriptor(), otherwise it
+/// is called again immediately. A file descriptor closed while being watched
+/// is dropped.
+/// @param fd The file descriptor to watch. It replaces any previous callback.
+/// @param on_readable The callback.
+void ScreenInteractive::WatchFileDescriptor(int fd, Closure on_readable) {
+  UnwatchFileDescriptor(fd);
+  watched_fds_.emplace_back(fd, std::move(on_readable));
+}
+
+/// @brief Stop watching |fd|, see WatchFileDescriptor().
+void ScreenInteractive::UnwatchFileDescriptor(int fd) {
+  watched_fds_.erase(
+      std::remove_if(watched_fds_.begin(), watched_fds_.end(),
+                     [fd](const auto& watched) { return watched.first == fd; }),
+      watched_fds_.end());
+}
+
+/// @brief Set the maximum number of frames drawn per second while animating.
+/// When no animation is requested, no frame is drawn until the next event.
+/// @param frames_per_second The frame rate. Default is 60.
+void ScreenInteractive::SetFrameRate(int frames_per_second) {
+  const std::lock_guard<std::mutex> lock(frame_timer_mutex_);
+  frame_duration_ =
+      std::chrono::microseconds(1'000'000 / std::max(1, frames_per_second));
+}
+
+/// @brief Set whether redundant events are dropped before being dispatched:
+/// a mouse motion followed by another one, and a terminal resize followed by
+/// another one. Button presses and releases are always dispatched, and so is
+/// every Event::Custom posted.
+/// @param enabled Whether to coalesce the events. Default is true.
+void ScreenInteractive::SetEventCoalescing(bool enabled) {
+  event_coalescing_ = enabled;
+}
+
+/// @brief Set how long an incomplete escape sequence is awaited, before being
+/// reported as is. This is the latency of the Escape key, which the terminal
+/// sends as a lone ESC, the first byte of the other sequences.
+/// This takes effect the next time the loop starts.
+/// @param milliseconds The timeout. Default is 50ms.
+void ScreenInteractive::SetEscapeTimeout(int milliseconds) {
+  escape_timeout_ = std::max(0, milliseconds);
+}
+
+/// @brief Set whether to request the kitty keyboard protocol from the
+/// terminal. In terminals supporting it, the Escape key is reported
+/// unambiguously, and dispatched without waiting for the escape timeout. The
+/// other terminals ignore the request.
+/// This takes effect the next time the loop starts.
+/// See https://sw.kovidgoyal.net/kitty/keyboard-protocol/
+/// @param enabled Whether to use the protocol. Default is false.
+void ScreenInteractive::SetKittyKeyboardProtocol(bool enabled) {
+  kitty_keyboard_protocol_ = enabled;
+}
+
+/// @brief Set whether to allocate the elements of each frame from an arena.
+/// The elements built by Component::Render(), and the memory used to lay them
+/// out, are allocated by bumping a pointer, and released all at once after
+/// the frame is drawn. The next frame reuses this memory. The Elements lists
+/// built by the components and the strings given to the elements still use the
+/// global heap.
+/// The elements kept by the components after the frame stay valid, but
+/// prevent the memory of the frame from being reused.
+/// @param enabled Whether to use the arena. Default is false.
+/// @see Arena
+void ScreenInteractive::SetFrameArena(bool enabled) {
+  if (!enabled) {
+    frame_arena_ = nullptr;
+  } else if (!frame_arena_) {
+    frame_arena_ = std::make_shared<Arena>();
+  }
 }
 
 CapturedMouse ScreenInteractive::CaptureMouse() {
@@ -428,9 +645,9 @@ void ScreenInteractive::PreMain() {
     std::swap(suspended_screen_, g_active_screen);
     // Reset cursor position to the top of the screen and clear the screen.
     suspended_screen_->ResetCursorPosition();
-    std::cout << suspended_screen_->ResetPosition(/*clear=*/true);
-    suspended_screen_->dimx_ = 0;
-    suspended_screen_->dimy_ = 0;
+    suspended_screen_->output_buffer_ +=
+        suspended_screen_->ResetPosition(/*clear=*/true);
+    suspended_screen_->Resize(0, 0);
 
     // Reset dimensions to force drawing the screen again next time:
     suspended_screen_->Uninstall();
@@ -452,9 +669,8 @@ void ScreenInteractive::PostMain() {
   // Restore suspended screen.
   if (suspended_screen_) {
     // Clear screen, and put the cursor at the beginning of the drawing.
-    std::cout << ResetPosition(/*clear=*/true);
-    dimx_ = 0;
-    dimy_ = 0;
+    output_buffer_ += ResetPosition(/*clear=*/true);
+    Resize(0, 0);
     Uninstall();
     std::swap(g_active_screen, suspended_screen_);
     g_active_screen->Install();
@@ -462,7 +678,8 @@ void ScreenInteractive::PostMain() {
     Uninstall();
     // On final exit, keep the current drawing and reset cursor position one
     // line after it.
-    std::cout << std::endl;
+    output_buffer_ += '\n';
+    FlushOutputBlocking();
   }
 }
 
@@ -485,9 +702,26 @@ ScreenInteractive* ScreenInteractive::Active() {
 void ScreenInteractive::Install() {
   frame_valid_ = false;
 
+  // The terminal content is unknown. The next frame must be drawn entirely.
+  previous_frame_ = Screen(0, 0);
+
+  // Anything printed by the application before must appear first.
+  std::cout << std::flush;
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  // Never block on a slow terminal. Frames are dropped instead, see Draw().
+  output_fd_ = OpenOutput();
+  if (output_fd_ != STDOUT_FILENO) {
+    on_exit_functions.push([this] {
+      close(output_fd_);
+      output_fd_ = STDOUT_FILENO;
+    });
+  }
+#endif
+
   // After uninstalling the new configuration, flush it to the terminal to
   // ensure it is fully applied:
-  on_exit_functions.push([] { Flush(); });
+  on_exit_functions.push([this] { FlushOutputBlocking(); });
 
   on_exit_functions.push([this] { ExitLoopClosure()(); });
 
@@ -530,6 +764,10 @@ void ScreenInteractive::Install() {
   SetConsoleMode(stdin_handle, in_mode);
   SetConsoleMode(stdout_handle, out_mode);
 #else
+#if !defined(__EMSCRIPTEN__)
+  CreateWakePipe();
+#endif
+
   for (const int signal : {SIGWINCH, SIGTSTP}) {
     InstallSignalHandler(signal);
   }
@@ -542,22 +780,19 @@ void ScreenInteractive::Install() {
   terminal.c_lflag &= ~ECHO;    // NOLINT Do not print after a key press.
   terminal.c_cc[VMIN] = 0;
   terminal.c_cc[VTIME] = 0;
-  // auto oldf = fcntl(STDIN_FILENO, F_GETFL, 0);
-  // fcntl(STDIN_FILENO, F_SETFL, oldf | O_NONBLOCK);
-  // on_exit_functions.push([=] { fcntl(STDIN_FILENO, F_GETFL, oldf); });
 
   tcsetattr(STDIN_FILENO, TCSANOW, &terminal);
 
 #endif
 
   auto enable = [&](const std::vector<DECMode>& parameters) {
-    std::cout << Set(parameters);
-    on_exit_functions.push([=] { std::cout << Reset(parameters); });
+    output_buffer_ += Set(parameters);
+    on_exit_functions.push([=] { output_buffer_ += Reset(parameters); });
   };
 
   auto disable = [&](const std::vector<DECMode>& parameters) {
-    std::cout << Reset(parameters);
-    on_exit_functions.push([=] { std::cout << Set(parameters); });
+    output_buffer_ += Reset(parameters);
+    on_exit_functions.push([=] { output_buffer_ += Set(parameters); });
   };
 
   if (use_alternative_screen_) {
@@ -567,8 +802,8 @@ void ScreenInteractive::Install() {
   }
 
   on_exit_functions.push([=] {
-    std::cout << "\033[?25h";  // Enable cursor.
-    std::cout << "\033[?1 q";  // Cursor block blinking.
+    output_buffer_ += "\033[?25h";  // Enable cursor.
+    output_buffer_ += "\033[?1 q";  // Cursor block blinking.
   });
 
   disable({
@@ -581,42 +816,162 @@ void ScreenInteractive::Install() {
   enable({DECMode::kMouseUrxvtMode});
   enable({DECMode::kMouseSgrExtMode});
 
+  // Receive a pasted text at once, instead of character per character:
+  enable({DECMode::kBracketedPaste});
+
+  // Push the "disambiguate escape codes" flag of the kitty keyboard protocol,
+  // and pop it on exit.
+  if (kitty_keyboard_protocol_) {
+    output_buffer_ += CSI + ">1u";
+    on_exit_functions.push([=] { output_buffer_ += CSI + "<u"; });
+  }
+
   // After installing the new configuration, flush it to the terminal to
   // ensure it is fully applied:
-  Flush();
+  FlushOutputBlocking();
 
   quit_ = false;
   task_sender_ = task_receiver_->MakeSender();
+
+  // Wake up the loop to draw the first frame.
+  Post([] {});
+
+  // An animation requested before may have been interrupted:
+  frame_timer_armed_ = animation_requested_;
+
+  if (reactor_mode_) {
+    parser_ = std::make_shared<TerminalInputParser>(task_receiver_->MakeSender());
+    parser_->SetEscapeTimeout(escape_timeout_);
+    stdin_closed_ = false;
+    return;
+  }
+
   event_listener_ =
-      std::thread(&EventListener, &quit_, task_receiver_->MakeSender());
-  animation_listener_ =
-      std::thread(&AnimationListener, &quit_, task_receiver_->MakeSender());
+      std::thread(&EventListener, &quit_, task_receiver_->MakeSender(),
+                  escape_timeout_);
+  animation_listener_ = std::thread(&ScreenInteractive::FrameTimer, this,
+                                    task_receiver_->MakeSender());
 }
 
 void ScreenInteractive::Uninstall() {
   ExitNow();
-  event_listener_.join();
-  animation_listener_.join();
+  if (event_listener_.joinable()) {
+    event_listener_.join();
+  }
+  if (animation_listener_.joinable()) {
+    animation_listener_.join();
+  }
   OnExit();
 }
 
 // NOLINTNEXTLINE
 void ScreenInteractive::RunOnceBlocking(Component component) {
   ExecuteSignalHandlers();
+  if (reactor_mode_) {
+    WaitReactor(/*timeout=*/-1);
+    ExecuteSignalHandlers();
+    HandleTasks(component);
+    return;
+  }
+
+  // The task received is handled by HandleTasks(), along with the next ones.
   Task task;
   if (task_receiver_->Receive(&task)) {
-    HandleTask(component, task);
+    tasks_.push_back(std::move(task));
   }
-  RunOnce(component);
+  HandleTasks(component);
 }
 
 void ScreenInteractive::RunOnce(Component component) {
-  Task task;
-  while (task_receiver_->ReceiveNonBlocking(&task)) {
-    HandleTask(component, task);
+  // In reactor mode, nothing reads the terminal and the file descriptors in
+  // the background. Collect what is ready, without waiting.
+  if (reactor_mode_) {
+    WaitReactor(/*timeout=*/0);
     ExecuteSignalHandlers();
   }
-  Draw(std::move(component));
+  HandleTasks(component);
+}
+
+// Handle the pending tasks, then draw a new frame if needed.
+void ScreenInteractive::HandleTasks(Component component) {
+  // Handle the pending tasks in batches, taken from the queue at once.
+  std::vector<Task> tasks;
+  std::swap(tasks, tasks_);
+  task_receiver_->ReceiveAll(&tasks);
+  while (!tasks.empty()) {
+    if (event_coalescing_) {
+      CoalesceEvents(&tasks);
+    }
+    for (Task& task : tasks) {
+      HandleTask(component, task);
+      ExecuteSignalHandlers();
+    }
+    tasks.clear();
+    task_receiver_->ReceiveAll(&tasks);
+  }
+  std::swap(tasks, tasks_);
+
+  // Apply the latest updates, once per frame.
+  std::vector<Closure> closures;
+  std::swap(closures, mailbox_closures_);
+  if (mailbox_->ReceiveAll(&closures)) {
+    for (Closure& closure : closures) {
+      closure();
+    }
+    closures.clear();
+    frame_valid_ = false;
+  }
+  std::swap(closures, mailbox_closures_);
+
+  if (!frame_arena_) {
+    Draw(std::move(component));
+    return;
+  }
+
+  // The elements of the frame are allocated from the arena, and released all
+  // at once after being drawn.
+  {
+    const ArenaScope scope(frame_arena_.get());
+    Draw(std::move(component));
+  }
+  frame_arena_->Reset();
+}
+
+// Remove the events made redundant by the one received right after:
+// - A mouse motion, followed by another one. Button transitions and wheel
+//   events are kept.
+// - A terminal resize, followed by another one. Event::Custom is identical to
+//   the components, but is never removed.
+void ScreenInteractive::CoalesceEvents(std::vector<Task>* tasks) {
+  size_t kept = 0;
+  for (size_t i = 0; i < tasks->size(); ++i) {
+    Task& task = (*tasks)[i];
+    Event* event = std::get_if<Event>(&task);
+    Event* next =
+        i + 1 < tasks->size() ? std::get_if<Event>(&(*tasks)[i + 1]) : nullptr;
+
+    bool redundant = false;
+    if (event && event->is_mouse()) {
+      const Mouse& mouse = event->mouse();
+      const bool motion = SameMouseAction(last_mouse_, mouse) &&
+                          mouse.button != Mouse::WheelUp &&
+                          mouse.button != Mouse::WheelDown;
+      last_mouse_ = mouse;
+      redundant = motion && next && next->is_mouse() &&
+                  SameMouseAction(mouse, next->mouse());
+    } else if (event && next) {
+      redundant = event->type_ == Event::Type::Resize &&
+                  next->type_ == Event::Type::Resize;
+    }
+
+    if (!redundant) {
+      if (kept != i) {
+        (*tasks)[kept] = std::move(task);
+      }
+      kept++;
+    }
+  }
+  tasks->resize(kept);
 }
 
 bool ScreenInteractive::SetCapturedComponent(ComponentBase* comp) {
@@ -656,10 +1011,32 @@ void ScreenInteractive::HandleTask(Component component, Task& task) {
         arg.mouse().y -= cursor_y_;
       }
 
+#if !defined(_WIN32)
+      // With the kitty keyboard protocol, the terminal reports CTRL+C and
+      // CTRL+Z as keys, instead of raising the signals.
+      if (kitty_keyboard_protocol_) {
+        static const Event ctrl_c = Event::Special({3});
+        static const Event ctrl_z = Event::Special({26});
+        if (arg == ctrl_c) {
+          std::raise(SIGINT);
+          return;
+        }
+        if (arg == ctrl_z) {
+          std::raise(SIGTSTP);
+          return;
+        }
+      }
+#endif
+
       arg.screen_ = this;
-      component->OnEvent(arg);
+      const bool handled = component->OnEvent(arg);
 
-      frame_valid_ = false;
+      // An event not handled by any component doesn't change the frame. Custom
+      // events are posted to request a new one, and resizing the terminal
+      // requires one. Both are Event::Special({0}).
+      if (handled || arg == Event::Custom) {
+        frame_valid_ = false;
+      }
 
       if (arg.is_mouse()) {
         if (arg.mouse().button == Mouse::Left && arg.mouse().motion == Mouse::Released) {
@@ -702,10 +1079,23 @@ void ScreenInteractive::Draw(Component component) {
   if (frame_valid_) {
     return;
   }
+
+  // The terminal is still busy with the previous frame. Drop this one. The
+  // next one will contain every change made in between. In reactor mode, the
+  // loop waits for the terminal to be writable. Otherwise, the FrameTimer is
+  // used to retry at the frame rate, until the terminal accepts the output.
+  if (!FlushOutput()) {
+    if (!reactor_mode_) {
+      ArmFrameTimer();
+    }
+    return;
+  }
+
   auto document = component->Render();
   int dimx = 0;
   int dimy = 0;
   auto terminal = Terminal::Size();
+  document->SetAvailableWidth(terminal.dimx);
   document->ComputeRequirement();
   switch (dimension_) {
     case Dimension::Fixed:
@@ -727,16 +1117,20 @@ void ScreenInteractive::Draw(Component component) {
   }
 
   const bool resized = (dimx != dimx_) || (dimy != dimy_);
-  ResetCursorPosition();
-  std::cout << ResetPosition(/*clear=*/resized);
+
+  // In the alternate screen, the frame always covers the whole terminal. Only
+  // the cells modified since the previous frame need to be sent.
+  const bool differential = use_alternative_screen_ && !resized &&
+                            previous_frame_.dimx() == dimx &&
+                            previous_frame_.dimy() == dimy;
+  if (!differential) {
+    ResetCursorPosition();
+    output_buffer_ += ResetPosition(/*clear=*/resized);
+  }
 
   // Resize the screen if needed.
   if (resized) {
-    dimx_ = dimx;
-    dimy_ = dimy;
-    pixels_ = std::vector<std::vector<Pixel>>(dimy, std::vector<Pixel>(dimx));
-    cursor_.x = dimx_ - 1;
-    cursor_.y = dimy_ - 1;
+    Resize(dimx, dimy);
   }
 
   // Periodically request the terminal emulator the frame position relative to
@@ -752,14 +1146,14 @@ void ScreenInteractive::Draw(Component component) {
   static int i = -3;
   ++i;
   if (!use_alternative_screen_ && (i % 150 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
+    output_buffer_ += DeviceStatusReport(DSRMode::kCursor);
   }
 #else
   static int i = -3;
   ++i;
   if (!use_alternative_screen_ &&
       (previous_frame_resized_ || i % 40 == 0)) {  // NOLINT
-    std::cout << DeviceStatusReport(DSRMode::kCursor);
+    output_buffer_ += DeviceStatusReport(DSRMode::kCursor);
   }
 #endif
   previous_frame_resized_ = resized;
@@ -771,29 +1165,107 @@ void ScreenInteractive::Draw(Component component) {
     const int dx = dimx_ - 1 - cursor_.x + int(dimx_ != terminal.dimx);
     const int dy = dimy_ - 1 - cursor_.y;
 
-    set_cursor_position = "\x1B[" + std::to_string(dy) + "A" +  //
-                          "\x1B[" + std::to_string(dx) + "D";
-    reset_cursor_position = "\x1B[" + std::to_string(dy) + "B" +  //
-                            "\x1B[" + std::to_string(dx) + "C";
+    set_cursor_position.clear();
+    AppendCursorMove(set_cursor_position, dy, 'A');
+    AppendCursorMove(set_cursor_position, dx, 'D');
+    reset_cursor_position.clear();
+    AppendCursorMove(reset_cursor_position, dy, 'B');
+    AppendCursorMove(reset_cursor_position, dx, 'C');
 
     if (cursor_.shape == Cursor::Hidden) {
       set_cursor_position += "\033[?25l";
     } else {
       set_cursor_position += "\033[?25h";
-      set_cursor_position +=
-          "\033[" + std::to_string(int(cursor_.shape)) + " q";
+      AppendCursorMove(set_cursor_position, int(cursor_.shape), ' ');
+      set_cursor_position += 'q';
+    }
+  }
+
+  if (differential) {
+    const size_t size = output_buffer_.size();
+    EncodeDiff(previous_frame_, output_buffer_);
+    const Cursor previous_cursor = previous_frame_.cursor();
+    const bool cursor_moved = cursor_.x != previous_cursor.x ||
+                              cursor_.y != previous_cursor.y ||
+                              cursor_.shape != previous_cursor.shape;
+    if (output_buffer_.size() == size && !cursor_moved) {
+      FlushOutput();
+      Clear();
+      frame_valid_ = true;
+      return;
     }
+
+    // Put the cursor back where drawing the whole frame would have left it,
+    // so that |set_cursor_position| applies.
+    output_buffer_ += "\x1B[";
+    util::AppendDecimal(output_buffer_, dimy_);
+    output_buffer_ += ';';
+    util::AppendDecimal(output_buffer_, dimx_ + int(dimx_ != terminal.dimx));
+    output_buffer_ += 'H';
+  } else {
+    Encode(output_buffer_);
   }
+  output_buffer_ += set_cursor_position;
+  FlushOutput();
 
-  std::cout << ToString() << set_cursor_position;
-  Flush();
+  if (use_alternative_screen_) {
+    previous_frame_ = static_cast<const Screen&>(*this);
+  }
   Clear();
   frame_valid_ = true;
 }
 
 void ScreenInteractive::ResetCursorPosition() {
-  std::cout << reset_cursor_position;
-  reset_cursor_position = "";
+  output_buffer_ += reset_cursor_position;
+  reset_cursor_position.clear();
+}
+
+// Send the pending output to the terminal, without blocking. Return whether
+// everything was sent. Otherwise, the rest is sent first by the next call.
+bool ScreenInteractive::FlushOutput() {
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+  // Emscripten doesn't implement flush. We interpret zero as flush.
+  std::cout << output_buffer_ << '\0' << std::flush;
+#else
+  // stdout, when it isn't a terminal, is blocking. Write only once it is ready.
+  if (output_fd_ == STDOUT_FILENO &&
+      output_written_ < output_buffer_.size()) {
+    pollfd fd = {STDOUT_FILENO, POLLOUT, 0};
+    if (poll(&fd, 1, 0) == 0) {
+      return false;
+    }
+  }
+  while (output_written_ < output_buffer_.size()) {
+    const ssize_t written =
+        write(output_fd_, output_buffer_.data() + output_written_,
+              output_buffer_.size() - output_written_);
+    if (written >= 0) {
+      output_written_ += size_t(written);
+      continue;
+    }
+    if (errno == EINTR) {
+      continue;
+    }
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return false;
+    }
+    // The terminal is gone. There is nothing left to do with the output.
+    break;
+  }
+#endif
+  output_buffer_.clear();
+  output_written_ = 0;
+  return true;
+}
+
+// Send the pending output to the terminal, waiting for it if needed.
+void ScreenInteractive::FlushOutputBlocking() {
+  while (!FlushOutput()) {
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    pollfd fd = {output_fd_, POLLOUT, 0};
+    poll(&fd, 1, -1);
+#endif
+  }
 }
 
 Closure ScreenInteractive::ExitLoopClosure() {
@@ -805,8 +1277,164 @@ void ScreenInteractive::Exit() {
 }
 
 void ScreenInteractive::ExitNow() {
-  quit_ = true;
+  {
+    const std::lock_guard<std::mutex> lock(frame_timer_mutex_);
+    quit_ = true;
+  }
+  frame_timer_cv_.notify_one();
+  Wake();
   task_sender_.reset();
+  parser_.reset();
+}
+
+// Make the FrameTimer send the next AnimationTask.
+void ScreenInteractive::ArmFrameTimer() {
+  {
+    const std::lock_guard<std::mutex> lock(frame_timer_mutex_);
+    if (frame_timer_armed_) {
+      return;
+    }
+    frame_timer_armed_ = true;
+  }
+  frame_timer_cv_.notify_one();
+}
+
+// Send an AnimationTask each time the timer is armed, no sooner than
+// |frame_duration_| after the previous one. At most one is in flight, so a slow
+// loop lowers the frame rate instead of accumulating late frames.
+void ScreenInteractive::FrameTimer(Sender<Task> out) {
+  std::unique_lock<std::mutex> lock(frame_timer_mutex_);
+  while (true) {
+    frame_timer_cv_.wait(lock, [&] { return quit_ || frame_timer_armed_; });
+    frame_timer_cv_.wait_until(lock, frame_timer_previous_ + frame_duration_,
+                               [&] { return bool(quit_); });
+    if (quit_) {
+      return;
+    }
+    frame_timer_armed_ = false;
+    frame_timer_previous_ = animation::Clock::now();
+
+    lock.unlock();
+    out->Send(AnimationTask());
+    lock.lock();
+  }
+}
+
+// Wait until there is something for the loop to do, in reactor mode, but no
+// more than |timeout| milliseconds. A negative |timeout| waits without limit.
+void ScreenInteractive::WaitReactor(int timeout) {
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  std::vector<pollfd> fds;
+  fds.push_back({g_wake_pipe[0], POLLIN, 0});
+  if (!stdin_closed_ && parser_) {
+    fds.push_back({STDIN_FILENO, POLLIN, 0});
+  }
+  for (const auto& watched : watched_fds_) {
+    fds.push_back({watched.first, POLLIN, 0});
+  }
+  // The rest of the output, not accepted by the terminal yet.
+  if (output_written_ < output_buffer_.size()) {
+    fds.push_back({output_fd_, POLLOUT, 0});
+  }
+
+  // Sleep as long as possible: until the next animation frame, or until the end
+  // of an incomplete escape sequence.
+  const auto now = animation::Clock::now();
+  const auto shorten = [&timeout](int milliseconds) {
+    timeout = timeout < 0 ? milliseconds : std::min(timeout, milliseconds);
+  };
+  {
+    const std::lock_guard<std::mutex> lock(frame_timer_mutex_);
+    if (frame_timer_armed_) {
+      const auto delay = std::chrono::ceil<std::chrono::milliseconds>(
+          frame_timer_previous_ + frame_duration_ - now);
+      shorten(std::max(0, int(delay.count())));
+    }
+  }
+  if (parser_ && parser_->HasPending()) {
+    shorten(parser_->TimeoutRemaining());
+  }
+
+  // Tasks posted from now on write to the wake pipe.
+  reactor_waiting_ = true;
+  if (task_receiver_->HasPending()) {
+    timeout = 0;
+  }
+  poll(fds.data(), fds.size(), timeout);
+  reactor_waiting_ = false;
+
+  const auto elapsed = std::chrono::ceil<std::chrono::milliseconds>(
+      animation::Clock::now() - now);
+
+  bool input = false;
+  for (const pollfd& fd : fds) {
+    if (!fd.revents) {
+      continue;
+    }
+
+    if (fd.fd == g_wake_pipe[0]) {
+      DrainWakePipe();
+      continue;
+    }
+
+    // The frame dropped, if any, is drawn after.
+    if (fd.events == POLLOUT) {
+      FlushOutput();
+      continue;
+    }
+
+    if (fd.fd == STDIN_FILENO) {
+      std::array<char, 4096> buffer;  // NOLINT
+      const ssize_t size = read(STDIN_FILENO, buffer.data(), buffer.size());
+      if (size == 0 || (size < 0 && errno != EINTR && errno != EAGAIN)) {
+        stdin_closed_ = true;
+      }
+      if (size > 0) {
+        parser_->Add(buffer.data(), size_t(size));
+      }
+      input = size > 0;
+      continue;
+    }
+
+    // A file descriptor closed without being unwatched would make poll()
+    // return immediately forever.
+    if (fd.revents & POLLNVAL) {
+      UnwatchFileDescriptor(fd.fd);
+      continue;
+    }
+
+    // The callback may unwatch file descriptors.
+    for (const auto& watched : watched_fds_) {
+      if (watched.first == fd.fd) {
+        const Closure callback = watched.second;
+        callback();
+        break;
+      }
+    }
+  }
+
+  if (!input && parser_ && parser_->HasPending()) {
+    parser_->Timeout(int(elapsed.count()));
+  }
+
+  // Handle the animation frame, if it is time.
+  bool animate = false;
+  {
+    const std::lock_guard<std::mutex> lock(frame_timer_mutex_);
+    const auto time = animation::Clock::now();
+    if (frame_timer_armed_ &&
+        time >= frame_timer_previous_ + frame_duration_) {
+      frame_timer_armed_ = false;
+      frame_timer_previous_ = time;
+      animate = true;
+    }
+  }
+  if (animate) {
+    tasks_.emplace_back(AnimationTask());
+  }
+#else
+  (void)timeout;
+#endif
 }
 
 void ScreenInteractive::Signal(int signal) {
@@ -820,11 +1448,10 @@ void ScreenInteractive::Signal(int signal) {
   if (signal == SIGTSTP) {
     Post([&] {
       ResetCursorPosition();
-      std::cout << ResetPosition(/*clear*/ true);  // Cursor to the beginning
+      // Cursor to the beginning:
+      output_buffer_ += ResetPosition(/*clear*/ true);
       Uninstall();
-      dimx_ = 0;
-      dimy_ = 0;
-      Flush();
+      Resize(0, 0);
       std::ignore = std::raise(SIGTSTP);
       Install();
     });
@@ -832,7 +1459,10 @@ void ScreenInteractive::Signal(int signal) {
   }
 
   if (signal == SIGWINCH) {
-    Post(Event::Special({0}));
+    // Event::Custom, tagged so that only the resizes are coalesced.
+    Event resize = Event::Custom;
+    resize.type_ = Event::Type::Resize;
+    Post(std::move(resize));
     return;
   }
 #endif
@@ -1,12 +1,27 @@
 #include <gtest/gtest.h>  // for Test, TestInfo (ptr only), TEST, EXPECT_EQ, Message, TestPartResult
+#include <array>   // for array
+#include <chrono>   // for milliseconds
+#include <functional>  // for function
 #include <csignal>  // for raise, SIGABRT, SIGFPE, SIGILL, SIGINT, SIGSEGV, SIGTERM
 #include <ftxui/component/event.hpp>  // for Event, Event::Custom
+#include <string>                     // for string
+#include <thread>                     // for thread, sleep_for
 #include <tuple>                      // for _Swallow_assign, ignore
+#include <vector>                     // for vector
 
-#include "ftxui/component/component.hpp"  // for Renderer
+#include "ftxui/component/animation.hpp"  // for RequestAnimationFrame
+#include "ftxui/component/component.hpp"  // for Renderer, CatchEvent
+#include "ftxui/component/loop.hpp"       // for Loop
+#include "ftxui/component/mouse.hpp"      // for Mouse
 #include "ftxui/component/screen_interactive.hpp"
 #include "ftxui/dom/elements.hpp"  // for text, Element
 
+#if !defined(_WIN32)
+#include <fcntl.h>   // for fcntl, F_GETFL, O_NONBLOCK
+#include <stdlib.h>  // for posix_openpt, grantpt, unlockpt, ptsname
+#include <unistd.h>  // for dup, dup2, pipe, read, close, STDOUT_FILENO
+#endif
+
 namespace ftxui {
 
 namespace {
@@ -61,6 +76,605 @@ TEST(ScreenInteractive, PostTaskToNonActive) {
   screen.Post([] {});
 }
 
+TEST(ScreenInteractive, AnimationFrames) {
+  auto screen = ScreenInteractive::FitComponent();
+  screen.SetFrameRate(1000);  // NOLINT
+  int frames = 0;
+  auto component = Renderer([&] {
+    if (++frames < 10) {
+      animation::RequestAnimationFrame();
+    } else {
+      screen.ExitLoopClosure()();
+    }
+    return text("");
+  });
+  screen.Loop(component);
+  EXPECT_EQ(frames, 10);
+}
+
+TEST(ScreenInteractive, PostLatest) {
+  auto screen = ScreenInteractive::FitComponent();
+  int frames = 0;
+  int value = 0;
+  int executed = 0;
+  auto component = Renderer([&] {
+    if (++frames == 1) {
+      for (int i = 1; i <= 3; ++i) {
+        screen.PostLatest("value", [&, i] {
+          value = i;
+          executed++;
+        });
+      }
+    } else {
+      screen.ExitLoopClosure()();
+    }
+    return text("");
+  });
+  screen.Loop(component);
+
+  // Only the latest closure is executed, and a new frame is drawn.
+  EXPECT_EQ(value, 3);
+  EXPECT_EQ(executed, 1);
+  EXPECT_EQ(frames, 2);
+}
+
+namespace {
+Event MouseEvent(Mouse::Button button,
+                 Mouse::Motion motion,
+                 int x,
+                 int y = 0) {
+  Mouse mouse;
+  mouse.button = button;
+  mouse.motion = motion;
+  mouse.x = x;
+  mouse.y = y;
+  return Event::Mouse("", mouse);
+}
+
+// Post a burst of events from the first frame, and return the ones received.
+std::vector<Event> ReceiveBurst(bool coalescing) {
+  auto screen = ScreenInteractive::FitComponent();
+  screen.SetEventCoalescing(coalescing);
+  std::vector<Event> received;
+  bool posted = false;
+  auto component = Renderer([&] {
+    if (!posted) {
+      posted = true;
+      for (const Event& event : {
+               MouseEvent(Mouse::None, Mouse::Pressed, 1),
+               MouseEvent(Mouse::None, Mouse::Pressed, 2),
+               MouseEvent(Mouse::None, Mouse::Pressed, 3),
+               MouseEvent(Mouse::Left, Mouse::Pressed, 4),
+               MouseEvent(Mouse::Left, Mouse::Pressed, 5),
+               MouseEvent(Mouse::Left, Mouse::Pressed, 6),
+               MouseEvent(Mouse::Left, Mouse::Released, 6),
+               MouseEvent(Mouse::WheelDown, Mouse::Pressed, 6),
+               MouseEvent(Mouse::WheelDown, Mouse::Pressed, 6),
+               Event::Custom,
+               Event::Custom,
+           }) {
+        screen.PostEvent(event);
+      }
+      screen.ExitLoopClosure()();
+    }
+    return text("");
+  });
+  component |= CatchEvent([&](Event event) {
+    received.push_back(event);
+    return false;
+  });
+  screen.Loop(component);
+  return received;
+}
+}  // namespace
+
+TEST(ScreenInteractive, EventCoalescing) {
+  auto received = ReceiveBurst(/*coalescing=*/true);
+  ASSERT_EQ(received.size(), 8u);
+
+  // Coordinates are relative to the frame, starting at 1.
+  EXPECT_EQ(received[0].mouse().x, 2);
+  EXPECT_EQ(received[1].mouse().button, Mouse::Left);
+  EXPECT_EQ(received[1].mouse().x, 3);
+  EXPECT_EQ(received[2].mouse().x, 5);
+  EXPECT_EQ(received[3].mouse().motion, Mouse::Released);
+  EXPECT_EQ(received[4].mouse().button, Mouse::WheelDown);
+  EXPECT_EQ(received[5].mouse().button, Mouse::WheelDown);
+  // Posted Event::Custom are never merged.
+  EXPECT_EQ(received[6], Event::Custom);
+  EXPECT_EQ(received[7], Event::Custom);
+}
+
+TEST(ScreenInteractive, EventCoalescingDisabled) {
+  EXPECT_EQ(ReceiveBurst(/*coalescing=*/false).size(), 11u);
+}
+
+#if !defined(_WIN32)
+TEST(ScreenInteractive, ResizeCoalescing) {
+  auto screen = ScreenInteractive::FitComponent();
+  int received = 0;
+  auto component = Renderer([] { return text(""); });
+  component |= CatchEvent([&](Event event) {
+    received += event == Event::Custom;
+    return false;
+  });
+
+  Loop loop(&screen, component);
+  loop.RunOnce();
+
+  // The resizes are posted after handling the first event.
+  std::ignore = std::raise(SIGWINCH);
+  std::ignore = std::raise(SIGWINCH);
+  screen.PostEvent(Event::Custom);
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+
+  // Both Event::Custom, and a single resize, seen as Event::Custom.
+  EXPECT_EQ(received, 3);
+
+  screen.ExitLoopClosure()();
+}
+#endif
+
+TEST(ScreenInteractive, RedrawOnlyWhenInvalidated) {
+  auto screen = ScreenInteractive::FitComponent();
+  int frames = 0;
+  auto component = Renderer([&] {
+    frames++;
+    return text("");
+  });
+  component |= CatchEvent([](Event event) { return event == Event::Return; });
+
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(frames, 1);
+
+  // Not handled:
+  screen.PostEvent(Event::Character('a'));
+  loop.RunOnce();
+  EXPECT_EQ(frames, 1);
+
+  // Handled:
+  screen.PostEvent(Event::Return);
+  loop.RunOnce();
+  EXPECT_EQ(frames, 2);
+
+  screen.Post([&] { screen.Invalidate(); });
+  loop.RunOnce();
+  EXPECT_EQ(frames, 3);
+
+  screen.PostEvent(Event::Custom);
+  loop.RunOnce();
+  EXPECT_EQ(frames, 4);
+
+  screen.ExitLoopClosure()();
+}
+
+TEST(ScreenInteractive, RedrawOnInputHover) {
+  auto screen = ScreenInteractive::FitComponent();
+  int frames = 0;
+  std::string content = "input";
+  auto input = Input(&content, "");
+  auto component = Renderer(input, [&] {
+    frames++;
+    return input->Render();
+  });
+
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(frames, 1);
+
+  // Entering the input highlights it:
+  screen.PostEvent(MouseEvent(Mouse::None, Mouse::Pressed, 2, 1));
+  loop.RunOnce();
+  EXPECT_EQ(frames, 2);
+
+  // Moving inside doesn't change anything:
+  screen.PostEvent(MouseEvent(Mouse::None, Mouse::Pressed, 3, 1));
+  loop.RunOnce();
+  EXPECT_EQ(frames, 2);
+
+  // Leaving it removes the highlight:
+  screen.PostEvent(MouseEvent(Mouse::None, Mouse::Pressed, 100, 1));
+  loop.RunOnce();
+  EXPECT_EQ(frames, 3);
+
+  screen.ExitLoopClosure()();
+}
+
+TEST(ScreenInteractive, FrameArena) {
+  auto screen = ScreenInteractive::FitComponent();
+  screen.SetFrameArena(true);
+  std::vector<Node*> elements;
+  auto component = Renderer([&] {
+    auto element = text("frame");
+    elements.push_back(element.get());
+    return element;
+  });
+
+  Loop loop(&screen, component);
+  for (int i = 0; i < 3; ++i) {
+    screen.Post([&] { screen.Invalidate(); });
+    loop.RunOnce();
+  }
+
+  // Every frame reuses the memory of the previous one.
+  ASSERT_EQ(elements.size(), 3u);
+  EXPECT_EQ(elements[0], elements[1]);
+  EXPECT_EQ(elements[1], elements[2]);
+
+  screen.ExitLoopClosure()();
+}
+
+#if !defined(_WIN32)
+TEST(ScreenInteractive, ReactorAnimationFrames) {
+  auto screen = ScreenInteractive::FitComponent();
+  screen.SetReactorMode(true);
+  screen.SetFrameRate(1000);  // NOLINT
+  int frames = 0;
+  auto component = Renderer([&] {
+    if (++frames < 10) {
+      animation::RequestAnimationFrame();
+    } else {
+      screen.ExitLoopClosure()();
+    }
+    return text("");
+  });
+  screen.Loop(component);
+  EXPECT_EQ(frames, 10);
+}
+
+TEST(ScreenInteractive, ReactorPostFromThread) {
+  auto screen = ScreenInteractive::FitComponent();
+  screen.SetReactorMode(true);
+  std::thread thread;
+  auto component = Renderer([&] {
+    if (!thread.joinable()) {
+      thread = std::thread([&] { screen.Post(screen.ExitLoopClosure()); });
+    }
+    return text("");
+  });
+  screen.Loop(component);
+  thread.join();
+}
+
+TEST(ScreenInteractive, ReactorWatchFileDescriptor) {
+  std::array<int, 2> fds;
+  ASSERT_EQ(pipe(fds.data()), 0);
+
+  auto screen = ScreenInteractive::FitComponent();
+  screen.SetReactorMode(true);
+  std::string received;
+  screen.WatchFileDescriptor(fds[0], [&] {
+    std::array<char, 16> buffer;
+    const ssize_t size = read(fds[0], buffer.data(), buffer.size());
+    received.append(buffer.data(), size_t(size));
+    if (received.size() == 5) {
+      screen.UnwatchFileDescriptor(fds[0]);
+      screen.ExitLoopClosure()();
+    }
+  });
+
+  std::thread thread([&] {
+    ASSERT_EQ(write(fds[1], "hel", 3), 3);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_EQ(write(fds[1], "lo", 2), 2);
+  });
+  screen.Loop(Renderer([] { return text(""); }));
+  thread.join();
+  close(fds[0]);
+  close(fds[1]);
+
+  EXPECT_EQ(received, "hello");
+}
+
+TEST(ScreenInteractive, ReactorRunOnce) {
+  std::array<int, 2> fds;
+  ASSERT_EQ(pipe(fds.data()), 0);
+
+  auto screen = ScreenInteractive::FitComponent();
+  screen.SetReactorMode(true);
+  std::string received;
+  screen.WatchFileDescriptor(fds[0], [&] {
+    std::array<char, 16> buffer;
+    const ssize_t size = read(fds[0], buffer.data(), buffer.size());
+    received.append(buffer.data(), size_t(size));
+    screen.Invalidate();
+  });
+  int frames = 0;
+  auto component = Renderer([&] {
+    frames++;
+    return text(received);
+  });
+
+  Loop loop(&screen, component);
+  loop.RunOnce();
+  EXPECT_EQ(frames, 1);
+
+  // Nothing to read:
+  loop.RunOnce();
+  EXPECT_EQ(frames, 1);
+  EXPECT_EQ(received, "");
+
+  // The non-blocking loop reads the watched file descriptor too:
+  ASSERT_EQ(write(fds[1], "hello", 5), 5);
+  loop.RunOnce();
+  EXPECT_EQ(frames, 2);
+  EXPECT_EQ(received, "hello");
+
+  screen.UnwatchFileDescriptor(fds[0]);
+  screen.ExitLoopClosure()();
+  close(fds[0]);
+  close(fds[1]);
+}
+
+TEST(ScreenInteractive, ReactorDropClosedFileDescriptor) {
+  std::array<int, 2> fds;
+  ASSERT_EQ(pipe(fds.data()), 0);
+
+  auto screen = ScreenInteractive::FitComponent();
+  screen.SetReactorMode(true);
+  int called = 0;
+  screen.WatchFileDescriptor(fds[0], [&] { called++; });
+
+  Loop loop(&screen, Renderer([] { return text(""); }));
+  loop.RunOnce();
+
+  // Closed without being unwatched:
+  close(fds[0]);
+  close(fds[1]);
+  loop.RunOnce();
+  EXPECT_EQ(called, 0);
+
+  // The same number, reused by a new pipe, is no longer watched.
+  std::array<int, 2> new_fds;
+  ASSERT_EQ(pipe(new_fds.data()), 0);
+  ASSERT_EQ(new_fds[0], fds[0]);
+  ASSERT_EQ(write(new_fds[1], "x", 1), 1);
+  loop.RunOnce();
+  EXPECT_EQ(called, 0);
+
+  screen.ExitLoopClosure()();
+  close(new_fds[0]);
+  close(new_fds[1]);
+}
+
+TEST(ScreenInteractive, OutputWrittenToStdout) {
+  std::array<int, 2> fds;
+  ASSERT_EQ(pipe(fds.data()), 0);
+  const int stdout_fd = dup(STDOUT_FILENO);
+  dup2(fds[1], STDOUT_FILENO);
+  const int flags = fcntl(STDOUT_FILENO, F_GETFL, 0);
+
+  auto screen = ScreenInteractive::FitComponent();
+  auto component = Renderer([&] {
+    screen.ExitLoopClosure()();
+    return text("output");
+  });
+  screen.Loop(component);
+
+  // The terminal is restored as it was.
+  EXPECT_EQ(fcntl(STDOUT_FILENO, F_GETFL, 0), flags);
+
+  dup2(stdout_fd, STDOUT_FILENO);
+  close(stdout_fd);
+  close(fds[1]);
+
+  std::string output;
+  std::array<char, 256> buffer;  // NOLINT
+  ssize_t size = 0;
+  while ((size = read(fds[0], buffer.data(), buffer.size())) > 0) {
+    output.append(buffer.data(), size_t(size));
+  }
+  close(fds[0]);
+
+  EXPECT_NE(output.find("output"), std::string::npos);
+  EXPECT_EQ(output.find('\0'), std::string::npos);
+  EXPECT_EQ(output.back(), '\n');
+}
+
+// In reactor mode, the output not accepted by the terminal is sent as soon as
+// it becomes writable.
+TEST(ScreenInteractive, ReactorWaitsForWritableOutput) {
+  std::array<int, 2> fds;
+  ASSERT_EQ(pipe(fds.data()), 0);
+  const int stdout_fd = dup(STDOUT_FILENO);
+  dup2(fds[1], STDOUT_FILENO);
+  fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL, 0) | O_NONBLOCK);
+
+  auto screen = ScreenInteractive::FitComponent();
+  screen.SetReactorMode(true);
+  int frames = 0;
+  auto component = Renderer([&] {
+    return text("frame" + std::to_string(++frames));
+  });
+
+  bool found = false;
+  {
+    Loop loop(&screen, component);
+    loop.RunOnce();
+
+    // Fill the pipe, so that the next frame isn't accepted.
+    const int flags = fcntl(fds[1], F_GETFL, 0);
+    fcntl(fds[1], F_SETFL, flags | O_NONBLOCK);
+    const std::string filler(4096, ' ');  // NOLINT
+    while (write(fds[1], filler.data(), filler.size()) > 0) {
+    }
+    fcntl(fds[1], F_SETFL, flags);
+
+    screen.PostEvent(Event::Custom);
+    loop.RunOnce();
+    EXPECT_EQ(frames, 2);
+
+    // Read the pipe until the second frame is received, for at most 1s.
+    std::thread reader([&] {
+      std::string output;
+      std::array<char, 4096> buffer;  // NOLINT
+      const auto deadline =
+          std::chrono::steady_clock::now() + std::chrono::seconds(1);
+      while (!found && std::chrono::steady_clock::now() < deadline) {
+        const ssize_t size = read(fds[0], buffer.data(), buffer.size());
+        if (size > 0) {
+          output.append(buffer.data(), size_t(size));
+          found = output.find("frame2") != std::string::npos;
+        } else {
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+      }
+      screen.Post(screen.ExitLoopClosure());
+    });
+    while (!loop.HasQuitted()) {
+      loop.RunOnceBlocking();
+    }
+    reader.join();
+  }
+
+  dup2(stdout_fd, STDOUT_FILENO);
+  close(stdout_fd);
+  close(fds[0]);
+  close(fds[1]);
+
+  EXPECT_TRUE(found);
+}
+
+// The frames are written through a new file description of the terminal, so
+// stdout, shared with stdin and std::cout, stays blocking.
+TEST(ScreenInteractive, StdoutStaysBlocking) {
+  const int master = posix_openpt(O_RDWR | O_NOCTTY);
+  ASSERT_GE(master, 0);
+  ASSERT_EQ(grantpt(master), 0);
+  ASSERT_EQ(unlockpt(master), 0);
+  const int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+  ASSERT_GE(slave, 0);
+  fcntl(master, F_SETFL, fcntl(master, F_GETFL, 0) | O_NONBLOCK);
+
+  const int stdout_fd = dup(STDOUT_FILENO);
+  dup2(slave, STDOUT_FILENO);
+
+  bool nonblocking = true;
+  auto screen = ScreenInteractive::FitComponent();
+  auto component = Renderer([&] {
+    nonblocking = fcntl(STDOUT_FILENO, F_GETFL, 0) & O_NONBLOCK;
+    screen.ExitLoopClosure()();
+    return text("blocking");
+  });
+  screen.Loop(component);
+
+  dup2(stdout_fd, STDOUT_FILENO);
+  close(stdout_fd);
+
+  std::string output;
+  std::array<char, 256> buffer;  // NOLINT
+  ssize_t size = 0;
+  while ((size = read(master, buffer.data(), buffer.size())) > 0) {
+    output.append(buffer.data(), size_t(size));
+  }
+  close(slave);
+  close(master);
+
+  EXPECT_FALSE(nonblocking);
+  EXPECT_NE(output.find("blocking"), std::string::npos);
+}
+
+namespace {
+// Send |input| to the terminal, through a pty, and return how long it takes
+// for the Escape key to be dispatched. Return milliseconds::max() when it isn't
+// dispatched within |wait|.
+std::chrono::milliseconds EscapeLatency(
+    const std::string& input,
+    std::chrono::milliseconds wait,
+    const std::function<void(ScreenInteractive&)>& configure) {
+  const int master = posix_openpt(O_RDWR | O_NOCTTY);
+  EXPECT_GE(master, 0);
+  EXPECT_EQ(grantpt(master), 0);
+  EXPECT_EQ(unlockpt(master), 0);
+  const int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+  EXPECT_GE(slave, 0);
+  fcntl(master, F_SETFL, fcntl(master, F_GETFL, 0) | O_NONBLOCK);
+
+  const int stdin_fd = dup(STDIN_FILENO);
+  const int stdout_fd = dup(STDOUT_FILENO);
+  dup2(slave, STDIN_FILENO);
+  dup2(slave, STDOUT_FILENO);
+
+  auto screen = ScreenInteractive::FitComponent();
+  configure(screen);
+  auto received = std::chrono::steady_clock::time_point();
+  auto component = CatchEvent(Renderer([] { return text("latency"); }),
+                              [&](const Event& event) {
+                                if (event == Event::Escape) {
+                                  received = std::chrono::steady_clock::now();
+                                  screen.ExitLoopClosure()();
+                                }
+                                return false;
+                              });
+
+  std::array<char, 256> buffer;  // NOLINT
+  auto drain = [&] {
+    while (read(master, buffer.data(), buffer.size()) > 0) {
+    }
+  };
+
+  auto sent = std::chrono::steady_clock::now();
+  {
+    Loop loop(&screen, component);
+    loop.RunOnce();
+    drain();
+    sent = std::chrono::steady_clock::now();
+    std::ignore = write(master, input.data(), input.size());
+    const auto deadline = std::chrono::steady_clock::now() + wait;
+    while (!loop.HasQuitted() && std::chrono::steady_clock::now() < deadline) {
+      loop.RunOnce();
+      drain();
+      std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+  }
+  drain();
+
+  dup2(stdin_fd, STDIN_FILENO);
+  dup2(stdout_fd, STDOUT_FILENO);
+  close(stdin_fd);
+  close(stdout_fd);
+  close(slave);
+  close(master);
+
+  if (received == std::chrono::steady_clock::time_point()) {
+    return std::chrono::milliseconds::max();
+  }
+  return std::chrono::duration_cast<std::chrono::milliseconds>(received -
+                                                               sent);
+}
+}  // namespace
+
+// The exact timing is checked by the TerminalInputParser tests. This only
+// checks the timeout reaches the parser, with bounds loose enough for a loaded
+// machine.
+TEST(ScreenInteractive, EscapeTimeout) {
+  // Not dispatched before the timeout:
+  const auto pending = EscapeLatency(
+      "\x1B", std::chrono::milliseconds(100),
+      [](ScreenInteractive& screen) { screen.SetEscapeTimeout(60000); });
+  EXPECT_EQ(pending, std::chrono::milliseconds::max());
+
+  // Dispatched after the timeout:
+  const auto latency = EscapeLatency(
+      "\x1B", std::chrono::seconds(10),
+      [](ScreenInteractive& screen) { screen.SetEscapeTimeout(5); });
+  EXPECT_GE(latency.count(), 5);
+  EXPECT_NE(latency, std::chrono::milliseconds::max());
+}
+
+TEST(ScreenInteractive, EscapeLatencyKittyKeyboardProtocol) {
+  // The Escape key is reported unambiguously. It doesn't wait for the timeout.
+  const auto latency = EscapeLatency(
+      "\x1B[27u", std::chrono::seconds(10), [](ScreenInteractive& screen) {
+        screen.SetEscapeTimeout(60000);
+        screen.SetKittyKeyboardProtocol(true);
+      });
+  EXPECT_NE(latency, std::chrono::milliseconds::max());
+}
+#endif
+
 }  // namespace ftxui
 
 // Copyright 2021 Arthur Sonzogni. All rights reserved.
@@ -107,7 +107,7 @@ class SliderBase : public ComponentBase {
     }
   }
 
-  bool OnEvent(Event event) final {
+  bool OnEvent(const Event& event) final {
     if (event.is_mouse()) {
       return OnMouseEvent(event);
     }
@@ -134,7 +134,7 @@ class SliderBase : public ComponentBase {
     return ComponentBase::OnEvent(event);
   }
 
-  bool OnMouseEvent(Event event) {
+  bool OnMouseEvent(const Event& event) {
     if (captured_mouse_ && event.mouse().motion == Mouse::Released) {
       captured_mouse_ = nullptr;
       return true;
@@ -206,7 +206,7 @@ class SliderWithLabel : public ComponentBase {
   }
 
  private:
-  bool OnEvent(Event event) final {
+  bool OnEvent(const Event& event) final {
     if (ComponentBase::OnEvent(event)) {
       return true;
     }
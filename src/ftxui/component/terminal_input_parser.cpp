@@ -1,14 +1,17 @@
 #include "ftxui/component/terminal_input_parser.hpp"
 
+#include <algorithm>                  // for max
 #include <cstdint>                    // for uint32_t
 #include <ftxui/component/mouse.hpp>  // for Mouse, Mouse::Button, Mouse::Motion
 #include <ftxui/component/receiver.hpp>  // for SenderImpl, Sender
 #include <map>
 #include <memory>   // for unique_ptr, allocator
+#include <string>   // for string
 #include <utility>  // for move
 
 #include "ftxui/component/event.hpp"  // for Event
 #include "ftxui/component/task.hpp"   // for Task
+#include "ftxui/screen/glyph.hpp"     // for Glyph
 
 namespace ftxui {
 
@@ -23,13 +26,61 @@ const std::map<std::string, std::string> g_uniformize = {
     {std::string({8}), std::string({127})},
 };
 
+namespace {
+
+const std::string kPasteBegin = "\x1B[200~";  // NOLINT
+const std::string kPasteEnd = "\x1B[201~";    // NOLINT
+
+// A paste larger than this is delivered in several events, so that the memory
+// used stays bounded. The parser stays in the paste until its end marker.
+const size_t kMaxPasteSize = 1 << 20;  // 1MiB
+
+// The end marker of a paste can be lost, for instance with a truncated write.
+// The paste is then terminated after this long without input, instead of
+// consuming the input forever.
+const int kPasteTimeout = 5000;  // 5s
+
+// Extract the text between the begin marker of a paste and |end|. Like for the
+// return key, the new lines are uniformized to `\n`.
+std::string PasteContent(const std::string& pending, size_t end) {
+  std::string content;
+  content.reserve(pending.size());
+  for (size_t i = kPasteBegin.size(); i < end; ++i) {
+    if (pending[i] != '\r') {
+      content += pending[i];
+    } else if (i + 1 == end || pending[i + 1] != '\n') {
+      content += '\n';
+    }
+  }
+  return content;
+}
+
+}  // namespace
+
 TerminalInputParser::TerminalInputParser(Sender<Task> out)
     : out_(std::move(out)) {}
 
+void TerminalInputParser::SetEscapeTimeout(int milliseconds) {
+  escape_timeout_ = milliseconds;
+}
+
+int TerminalInputParser::TimeoutRemaining() const {
+  const int timeout = state_ == State::Paste ? kPasteTimeout : escape_timeout_;
+  return std::max(0, timeout - timeout_);
+}
+
 void TerminalInputParser::Timeout(int time) {
   timeout_ += time;
-  const int timeout_threshold = 50;
-  if (timeout_ < timeout_threshold) {
+  // A large paste can be received slowly. It waits for the end marker much
+  // longer than the other sequences.
+  if (state_ == State::Paste) {
+    if (timeout_ >= kPasteTimeout) {
+      timeout_ = 0;
+      Send(UNTERMINATED_PASTE);
+    }
+    return;
+  }
+  if (timeout_ < escape_timeout_) {
     return;
   }
   timeout_ = 0;
@@ -39,22 +90,37 @@ void TerminalInputParser::Timeout(int time) {
 }
 
 void TerminalInputParser::Add(char c) {
-  pending_ += c;
   timeout_ = 0;
-  position_ = -1;
-  Send(Parse());
+  Send(Parse(c));
 }
 
-unsigned char TerminalInputParser::Current() {
-  return pending_[position_];
-}
-
-bool TerminalInputParser::Eat() {
-  position_++;
-  return position_ < (int)pending_.size();
+void TerminalInputParser::Add(const char* data, size_t size) {
+  timeout_ = 0;
+  for (size_t i = 0; i < size; ++i) {
+    Send(Parse(data[i]));  // NOLINT
+  }
 }
 
 void TerminalInputParser::Send(TerminalInputParser::Output output) {
+  if (output.type == UNCOMPLETED) {
+    return;
+  }
+
+  // Deliver the beginning of a large paste, and keep receiving it. The bytes
+  // that may be the start of the end marker, or of a `\r\n`, are kept.
+  if (output.type == PARTIAL_PASTE) {
+    size_t end = pending_.size() - paste_end_matched_;
+    if (pending_[end - 1] == '\r') {
+      --end;
+    }
+    out_->Send(Event::Paste(PasteContent(pending_, end)));
+    pending_.erase(kPasteBegin.size(), end - kPasteBegin.size());
+    return;
+  }
+
+  // A new sequence starts with the next byte.
+  state_ = State::Ground;
+
   switch (output.type) {
     case UNCOMPLETED:
       return;
@@ -89,35 +155,87 @@ void TerminalInputParser::Send(TerminalInputParser::Output output) {
                                         output.cursor.y));    // NOLINT
       pending_.clear();
       return;
+
+    case PASTE:
+      out_->Send(Event::Paste(
+          PasteContent(pending_, pending_.size() - kPasteEnd.size())));
+      pending_.clear();
+      return;
+
+    case UNTERMINATED_PASTE:
+      out_->Send(Event::Paste(PasteContent(pending_, pending_.size())));
+      pending_.clear();
+      return;
+
+    case PARTIAL_PASTE:
+      return;
   }
   // NOT_REACHED().
 }
 
-TerminalInputParser::Output TerminalInputParser::Parse() {
-  if (!Eat()) {
-    return UNCOMPLETED;
+// Consume one more byte of the sequence being received. The state of the
+// parser is kept in between, so that a byte is never parsed twice.
+TerminalInputParser::Output TerminalInputParser::Parse(char c) {
+  pending_ += c;
+  const auto byte = static_cast<unsigned char>(c);
+  switch (state_) {
+    case State::Ground:
+      return ParseGround(byte);
+    case State::UTF8:
+      return ParseUTF8(byte);
+    case State::ESC:
+      return ParseESC(byte);
+    case State::ESCFinal:
+      return SPECIAL;
+    case State::CSI:
+      return ParseCSI(byte);
+    case State::String:
+      if (byte == '\x1B') {
+        state_ = State::StringESC;
+      }
+      return UNCOMPLETED;
+    case State::Paste:
+      return ParsePaste(byte);
+    case State::StringESC:
+      // Parse until the string terminator ST.
+      if (byte == '\\') {
+        return SPECIAL;
+      }
+      state_ = State::String;
+      return UNCOMPLETED;
   }
+  // NOT_REACHED().
+  return DROP;
+}
 
-  switch (Current()) {
+TerminalInputParser::Output TerminalInputParser::ParseGround(
+    unsigned char byte) {
+  switch (byte) {
     case 24:  // CAN NOLINT
     case 26:  // SUB NOLINT
       return DROP;
 
     case '\x1B':
-      return ParseESC();
+      state_ = State::ESC;
+      return UNCOMPLETED;
     default:
       break;
   }
 
-  if (Current() < 32) {  // C0 NOLINT
+  if (byte < 32) {  // C0 NOLINT
     return SPECIAL;
   }
 
-  if (Current() == 127) {  // Delete // NOLINT
+  if (byte == 127) {  // Delete // NOLINT
     return SPECIAL;
   }
 
-  return ParseUTF8();
+  // Quick path for ASCII:
+  if (byte < 128) {  // NOLINT
+    return CHARACTER;
+  }
+
+  return ParseUTF8Head(byte);
 }
 
 // Code point <-> UTF-8 conversion
@@ -136,8 +254,8 @@ TerminalInputParser::Output TerminalInputParser::Parse() {
 //
 // Then some sequences are illegal if it exist a shorter representation of the
 // same codepoint.
-TerminalInputParser::Output TerminalInputParser::ParseUTF8() {
-  auto head = static_cast<unsigned char>(Current());
+TerminalInputParser::Output TerminalInputParser::ParseUTF8Head(
+    unsigned char head) {
   unsigned char selector = 0b1000'0000;  // NOLINT
 
   // The non code-point part of the first byte.
@@ -154,32 +272,34 @@ TerminalInputParser::Output TerminalInputParser::ParseUTF8() {
     selector >>= 1U;
   }
 
-  // Accumulate the value of the first byte.
-  auto value = uint32_t(head & ~mask);  // NOLINT
-
   // Invalid UTF8, with more than 5 bytes.
   const unsigned int max_utf8_bytes = 5;
   if (first_zero == 1 || first_zero >= max_utf8_bytes) {
     return DROP;
   }
 
-  // Multi byte UTF-8.
-  for (unsigned int i = 2; i <= first_zero; ++i) {
-    if (!Eat()) {
-      return UNCOMPLETED;
-    }
+  // Accumulate the value of the first byte.
+  utf8_value_ = uint32_t(head & ~mask);  // NOLINT
+  utf8_remaining_ = int(first_zero) - 1;
+  state_ = State::UTF8;
+  return UNCOMPLETED;
+}
 
-    // Invalid continuation byte.
-    head = static_cast<unsigned char>(Current());
-    if ((head & 0b1100'0000) != 0b1000'0000) {  // NOLINT
-      return DROP;
-    }
-    value <<= 6;                  // NOLINT
-    value += head & 0b0011'1111;  // NOLINT
+TerminalInputParser::Output TerminalInputParser::ParseUTF8(
+    unsigned char byte) {
+  // Invalid continuation byte.
+  if ((byte & 0b1100'0000) != 0b1000'0000) {  // NOLINT
+    return DROP;
+  }
+  utf8_value_ <<= 6;                  // NOLINT
+  utf8_value_ += byte & 0b0011'1111;  // NOLINT
+  if (--utf8_remaining_) {
+    return UNCOMPLETED;
   }
 
   // Check for overlong UTF8 encoding.
-  int extra_byte = 0;
+  const uint32_t value = utf8_value_;
+  size_t extra_byte = 0;
   if (value <= 0b000'0000'0111'1111) {                 // NOLINT
     extra_byte = 0;                                    // NOLINT
   } else if (value <= 0b000'0111'1111'1111) {          // NOLINT
@@ -192,127 +312,187 @@ TerminalInputParser::Output TerminalInputParser::ParseUTF8() {
     return DROP;
   }
 
-  if (extra_byte != position_) {
+  if (extra_byte + 1 != pending_.size()) {
     return DROP;
   }
 
   return CHARACTER;
 }
 
-TerminalInputParser::Output TerminalInputParser::ParseESC() {
-  if (!Eat()) {
-    return UNCOMPLETED;
-  }
-  switch (Current()) {
-    case 'P':
-      return ParseDCS();
+TerminalInputParser::Output TerminalInputParser::ParseESC(unsigned char byte) {
+  switch (byte) {
+    case 'P':  // DCS
+    case ']':  // OSC
+      state_ = State::String;
+      return UNCOMPLETED;
     case '[':
-      return ParseCSI();
-    case ']':
-      return ParseOSC();
+      state_ = State::CSI;
+      csi_altered_ = false;
+      csi_private_ = false;
+      csi_subparameter_ = false;
+      csi_argument_ = 0;
+      csi_arguments_.clear();
+      return UNCOMPLETED;
     default:
-      if (!Eat()) {
-        return UNCOMPLETED;
-      } else {
-        return SPECIAL;
-      }
+      state_ = State::ESCFinal;
+      return UNCOMPLETED;
   }
 }
 
-TerminalInputParser::Output TerminalInputParser::ParseDCS() {
-  // Parse until the string terminator ST.
-  while (true) {
-    if (!Eat()) {
-      return UNCOMPLETED;
-    }
+TerminalInputParser::Output TerminalInputParser::ParseCSI(unsigned char byte) {
+  if (byte == '<') {
+    csi_altered_ = true;
+    return UNCOMPLETED;
+  }
 
-    if (Current() != '\x1B') {
-      continue;
-    }
+  // Private parameters, like the replies to the queries of the terminal.
+  if (byte == '=' || byte == '>' || byte == '?') {
+    csi_private_ = true;
+    return UNCOMPLETED;
+  }
+
+  // Sub-parameters are ignored.
+  if (byte == ':') {
+    csi_subparameter_ = true;
+    return UNCOMPLETED;
+  }
 
-    if (!Eat()) {
+  if (byte >= '0' && byte <= '9') {
+    if (csi_subparameter_) {
       return UNCOMPLETED;
     }
+    csi_argument_ *= 10;  // NOLINT
+    csi_argument_ += int(byte - '0');
+    return UNCOMPLETED;
+  }
+
+  if (byte == ';') {
+    csi_arguments_.push_back(csi_argument_);
+    csi_argument_ = 0;
+    csi_subparameter_ = false;
+    return UNCOMPLETED;
+  }
 
-    if (Current() != '\\') {
-      continue;
+  if (byte >= ' ' && byte <= '~') {
+    csi_arguments_.push_back(csi_argument_);
+    csi_argument_ = 0;  // NOLINT
+    switch (byte) {
+      case 'M':
+        return ParseMouse(csi_altered_, true, csi_arguments_);
+      case 'm':
+        return ParseMouse(csi_altered_, false, csi_arguments_);
+      case 'R':
+        return ParseCursorReporting(csi_arguments_);
+      case '~':
+        if (csi_arguments_ == std::vector<int>{200}) {  // NOLINT
+          state_ = State::Paste;
+          paste_end_matched_ = 0;
+          return UNCOMPLETED;
+        }
+        return SPECIAL;
+      case 'u':
+        if (csi_private_) {
+          return SPECIAL;
+        }
+        return ParseKittyKey(csi_arguments_);
+      default:
+        return SPECIAL;
     }
+  }
 
+  // Invalid ESC in CSI.
+  if (byte == '\x1B') {
     return SPECIAL;
   }
-}
-
-TerminalInputParser::Output TerminalInputParser::ParseCSI() {
-  bool altered = false;
-  int argument = 0;
-  std::vector<int> arguments;
-  while (true) {
-    if (!Eat()) {
-      return UNCOMPLETED;
-    }
 
-    if (Current() == '<') {
-      altered = true;
-      continue;
-    }
+  return UNCOMPLETED;
+}
 
-    if (Current() >= '0' && Current() <= '9') {
-      argument *= 10;  // NOLINT
-      argument += int(Current() - '0');
-      continue;
-    }
+// A key reported using the kitty keyboard protocol: CSI code ; modifiers u
+// See https://sw.kovidgoyal.net/kitty/keyboard-protocol/
+// It is translated into the sequence the terminal sends traditionally, so that
+// components don't have to care about the protocol in use.
+TerminalInputParser::Output TerminalInputParser::ParseKittyKey(
+    const std::vector<int>& arguments) {
+  const int code = arguments[0];
+  const int modifiers = arguments.size() >= 2 ? arguments[1] - 1 : 0;
+  const int shift = 1;
+  const int alt = 2;
+  const int ctrl = 4;
+  const int caps_lock = 64;   // NOLINT
+  const int num_lock = 128;  // NOLINT
+
+  // Other modifiers, like super, can't be translated.
+  if (modifiers & ~(shift | alt | ctrl | caps_lock | num_lock)) {
+    return SPECIAL;
+  }
 
-    if (Current() == ';') {
-      arguments.push_back(argument);
-      argument = 0;
-      continue;
+  std::string key;
+  bool character = false;
+  if (modifiers & ctrl) {
+    if (code >= 'a' && code <= 'z') {
+      key = char(code & 0x1F);  // NOLINT
+    } else if (code == ' ') {
+      key = std::string({0});
+    } else {
+      return SPECIAL;
     }
-
-    if (Current() >= ' ' && Current() <= '~' && Current() != '<') {
-      arguments.push_back(argument);
-      argument = 0;  // NOLINT
-      switch (Current()) {
-        case 'M':
-          return ParseMouse(altered, true, std::move(arguments));
-        case 'm':
-          return ParseMouse(altered, false, std::move(arguments));
-        case 'R':
-          return ParseCursorReporting(std::move(arguments));
-        default:
+  } else {
+    switch (code) {
+      case 27:  // NOLINT
+        key = "\x1B";
+        break;
+      case 13:  // NOLINT
+        key = "\n";
+        break;
+      case 9:  // NOLINT
+        key = (modifiers & shift) ? "\x1B[Z" : "\t";
+        break;
+      case 127:  // NOLINT
+        key = std::string({127});
+        break;
+      default: {
+        if (code < ' ' || code > 0x10FFFF) {  // NOLINT
           return SPECIAL;
+        }
+        int codepoint = code;
+        if ((modifiers & shift) && code >= 'a' && code <= 'z') {
+          codepoint = code - 'a' + 'A';
+        }
+        key = Glyph::FromCodepoint(uint32_t(codepoint)).str();
+        character = !(modifiers & alt);
+        break;
       }
     }
+  }
 
-    // Invalid ESC in CSI.
-    if (Current() == '\x1B') {
-      return SPECIAL;
-    }
+  if (modifiers & alt) {
+    key = "\x1B" + key;
   }
+
+  pending_ = std::move(key);
+  return character ? CHARACTER : SPECIAL;
 }
 
-TerminalInputParser::Output TerminalInputParser::ParseOSC() {
-  // Parse until the string terminator ST.
-  while (true) {
-    if (!Eat()) {
-      return UNCOMPLETED;
-    }
-    if (Current() != '\x1B') {
-      continue;
+TerminalInputParser::Output TerminalInputParser::ParsePaste(
+    unsigned char byte) {
+  if (byte == kPasteEnd[paste_end_matched_]) {
+    if (++paste_end_matched_ == kPasteEnd.size()) {
+      return PASTE;
     }
-    if (!Eat()) {
-      return UNCOMPLETED;
-    }
-    if (Current() != '\\') {
-      continue;
-    }
-    return SPECIAL;
+    return UNCOMPLETED;
+  }
+  paste_end_matched_ = (byte == kPasteEnd[0]) ? 1 : 0;
+  if (pending_.size() - kPasteBegin.size() >= kMaxPasteSize) {
+    return PARTIAL_PASTE;
   }
+  return UNCOMPLETED;
 }
 
 TerminalInputParser::Output TerminalInputParser::ParseMouse(  // NOLINT
     bool altered,
     bool pressed,
-    std::vector<int> arguments) {
+    const std::vector<int>& arguments) {
   if (arguments.size() != 3) {
     return SPECIAL;
   }
@@ -332,7 +512,7 @@ TerminalInputParser::Output TerminalInputParser::ParseMouse(  // NOLINT
 
 // NOLINTNEXTLINE
 TerminalInputParser::Output TerminalInputParser::ParseCursorReporting(
-    std::vector<int> arguments) {
+    const std::vector<int>& arguments) {
   if (arguments.size() != 2) {
     return SPECIAL;
   }
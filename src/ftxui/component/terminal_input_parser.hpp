@@ -1,9 +1,11 @@
 #ifndef FTXUI_COMPONENT_TERMINAL_INPUT_PARSER
 #define FTXUI_COMPONENT_TERMINAL_INPUT_PARSER
 
-#include <memory>  // for unique_ptr
-#include <string>  // for string
-#include <vector>  // for vector
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <memory>   // for unique_ptr
+#include <string>   // for string
+#include <vector>   // for vector
 
 #include "ftxui/component/event.hpp"     // for Event (ptr only)
 #include "ftxui/component/mouse.hpp"     // for Mouse
@@ -14,15 +16,38 @@ namespace ftxui {
 struct Event;
 
 // Parse a sequence of |char| accross |time|. Produces |Event|.
+//
+// The parser is a state machine. It resumes where it stopped on the previous
+// call to Add(), so every byte is examined only once, even when a long sequence
+// is received in several parts.
 class TerminalInputParser {
  public:
   TerminalInputParser(Sender<Task> out);
   void Timeout(int time);
   void Add(char c);
+  void Add(const char* data, size_t size);
+
+  // Whether an incomplete sequence waits for more input, or for a Timeout().
+  bool HasPending() const { return !pending_.empty(); }
+
+  // An incomplete sequence, like a lone ESC, is reported as is after
+  // |milliseconds| without new input. Default is 50ms. A bracketed paste waits
+  // longer for its end marker.
+  void SetEscapeTimeout(int milliseconds);
+  // The time, in milliseconds, before the pending sequence is reported.
+  int TimeoutRemaining() const;
 
  private:
-  unsigned char Current();
-  bool Eat();
+  enum class State {
+    Ground,     // Waiting for the first byte of a sequence.
+    UTF8,       // Inside a multi-bytes UTF-8 codepoint.
+    ESC,        // After ESC.
+    ESCFinal,   // After ESC and an unknown byte.
+    CSI,        // After ESC [
+    String,     // Inside a DCS or an OSC: ESC P or ESC ]
+    StringESC,  // After ESC, inside a DCS or an OSC.
+    Paste,      // Between ESC [ 200 ~ and ESC [ 201 ~
+  };
 
   enum Type {
     UNCOMPLETED,
@@ -31,6 +56,9 @@ class TerminalInputParser {
     SPECIAL,
     MOUSE,
     CURSOR_REPORTING,
+    PASTE,
+    UNTERMINATED_PASTE,
+    PARTIAL_PASTE,  // The paste is too large, and continues.
   };
 
   struct CursorReporting {
@@ -49,19 +77,39 @@ class TerminalInputParser {
   };
 
   void Send(Output output);
-  Output Parse();
-  Output ParseUTF8();
-  Output ParseESC();
-  Output ParseDCS();
-  Output ParseCSI();
-  Output ParseOSC();
-  Output ParseMouse(bool altered, bool pressed, std::vector<int> arguments);
-  Output ParseCursorReporting(std::vector<int> arguments);
+  Output Parse(char c);
+  Output ParseGround(unsigned char byte);
+  Output ParseUTF8Head(unsigned char head);
+  Output ParseUTF8(unsigned char byte);
+  Output ParseESC(unsigned char byte);
+  Output ParseCSI(unsigned char byte);
+  Output ParsePaste(unsigned char byte);
+  Output ParseKittyKey(const std::vector<int>& arguments);
+  Output ParseMouse(bool altered,
+                    bool pressed,
+                    const std::vector<int>& arguments);
+  Output ParseCursorReporting(const std::vector<int>& arguments);
 
   Sender<Task> out_;
-  int position_ = -1;
   int timeout_ = 0;
+  int escape_timeout_ = 50;  // NOLINT
   std::string pending_;
+
+  State state_ = State::Ground;
+
+  // State::UTF8:
+  uint32_t utf8_value_ = 0;
+  int utf8_remaining_ = 0;
+
+  // State::CSI:
+  bool csi_altered_ = false;
+  bool csi_private_ = false;
+  bool csi_subparameter_ = false;
+  int csi_argument_ = 0;
+  std::vector<int> csi_arguments_;
+
+  // State::Paste: The number of bytes of the end marker already received.
+  size_t paste_end_matched_ = 0;
 };
 
 }  // namespace ftxui
@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>  // for AssertionResult, Test, Message, TestPartResult, SuiteApiResolver, TestInfo (ptr only), EXPECT_EQ, EXPECT_TRUE, TEST, TestFactoryImpl, EXPECT_FALSE
 #include <ftxui/component/mouse.hpp>  // for Mouse, Mouse::Left, Mouse::Middle, Mouse::Pressed, Mouse::Released, Mouse::Right
 #include <ftxui/component/task.hpp>   // for Task
+#include <algorithm>                  // for min
 #include <initializer_list>           // for initializer_list
 #include <memory>                     // for allocator, unique_ptr
+#include <string>                     // for string
 #include <variant>                    // for get
+#include <vector>                     // for vector
 
 #include "ftxui/component/event.hpp"  // for Event, Event::Return, Event::ArrowDown, Event::ArrowLeft, Event::ArrowRight, Event::ArrowUp, Event::Backspace, Event::Custom, Event::Delete, Event::End, Event::F10, Event::F11, Event::F12, Event::F5, Event::F6, Event::F7, Event::F8, Event::F9, Event::Home, Event::PageDown, Event::PageUp, Event::Tab, Event::TabReverse, Event::Escape
 #include "ftxui/component/receiver.hpp"  // for MakeReceiver, ReceiverImpl
@@ -384,6 +387,228 @@ TEST(Event, Special) {
   }
 }
 
+// Feeding a whole buffer at once, or byte per byte, produces the same events.
+TEST(Event, AddBuffer) {
+  const std::string input =
+      "a\x1B[A\x1B[<0;12;34M\xE2\x82\xAC\x1BP+r\x1B\\\x1B[12;34Rz";
+
+  auto parse = [](auto add) {
+    auto event_receiver = MakeReceiver<Task>();
+    {
+      auto parser = TerminalInputParser(event_receiver->MakeSender());
+      add(parser);
+    }
+    std::vector<Event> events;
+    Task received;
+    while (event_receiver->Receive(&received))
+      events.push_back(std::get<Event>(received));
+    return events;
+  };
+
+  auto buffer = parse([&](TerminalInputParser& parser) {
+    parser.Add(input.data(), input.size());
+  });
+  auto byte_per_byte = parse([&](TerminalInputParser& parser) {
+    for (char c : input)
+      parser.Add(c);
+  });
+
+  ASSERT_EQ(buffer.size(), 7u);
+  EXPECT_EQ(buffer, byte_per_byte);
+  EXPECT_EQ(buffer[0], Event::Character('a'));
+  EXPECT_EQ(buffer[1], Event::ArrowUp);
+  EXPECT_TRUE(buffer[2].is_mouse());
+  EXPECT_EQ(buffer[3], Event::Character("\xE2\x82\xAC"));
+  EXPECT_EQ(buffer[4], Event::Special("\x1BP+r\x1B\\"));
+  EXPECT_TRUE(buffer[5].is_cursor_reporting());
+  EXPECT_EQ(buffer[6], Event::Character('z'));
+}
+
+// A sequence split across several reads is resumed where it stopped.
+TEST(Event, SplitSequence) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    parser.Add("\x1B[<0;1", 6);
+    EXPECT_TRUE(parser.HasPending());
+    parser.Add("2;3", 3);
+    parser.Add("4Mx\xE2", 4);
+    EXPECT_TRUE(parser.HasPending());
+    parser.Add("\x82\xAC", 2);
+    EXPECT_FALSE(parser.HasPending());
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_TRUE(std::get<Event>(received).is_mouse());
+  EXPECT_EQ(std::get<Event>(received).mouse().x, 12);
+  EXPECT_EQ(std::get<Event>(received).mouse().y, 34);
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character('x'));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character("\xE2\x82\xAC"));
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
+// A long OSC received in many parts is reported once, when terminated.
+TEST(Event, LongOSC) {
+  std::string osc = "\x1B]52;c;";
+  for (int i = 0; i < 10000; ++i)
+    osc += "YWJj";
+  osc += "\x1B\\";
+
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    for (size_t i = 0; i < osc.size(); i += 100)
+      parser.Add(osc.data() + i, std::min<size_t>(100, osc.size() - i));
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Special(osc));
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
+// Bracketed paste: the pasted text is received in a single event.
+TEST(Event, Paste) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    const std::string input =
+        "a\x1B[200~b\x1B[A\r\nc\rd\x1B[201\x1B[201~e";
+    parser.Add(input.data(), input.size());
+    // A slow paste isn't interrupted by the timeout.
+    parser.Add("\x1B[200~xy", 8);
+    EXPECT_TRUE(parser.HasPending());
+    parser.Timeout(1000);
+    parser.Add("z\x1B[201~", 7);
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character('a'));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_TRUE(std::get<Event>(received).is_paste());
+  EXPECT_EQ(std::get<Event>(received).paste(), "b\x1B[A\nc\nd\x1B[201");
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character('e'));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Paste("xyz"));
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
+// A paste whose end marker never arrives doesn't consume the input forever.
+TEST(Event, PasteWithoutEndMarker) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+
+    // Terminated by the inactivity timeout:
+    parser.Add("\x1B[200~ab\x1B[20", 12);
+    EXPECT_EQ(parser.TimeoutRemaining(), 5000);
+    parser.Timeout(4999);
+    EXPECT_TRUE(parser.HasPending());
+    parser.Timeout(1);
+    EXPECT_FALSE(parser.HasPending());
+    parser.Add('x');
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Paste("ab\x1B[20"));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character('x'));
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
+// A paste larger than 1MiB is delivered in several events. The rest is still
+// received as pasted text, not as keys.
+TEST(Event, LargePaste) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    // The limit is reached in between `\r\n`.
+    const std::string large((1 << 20) - 1, 'a');
+    parser.Add("\x1B[200~", 6);
+    parser.Add(large.data(), large.size());
+    parser.Add("\r\nb\rc\x1B[A", 8);
+    EXPECT_TRUE(parser.HasPending());
+    parser.Add("\x1B[201~y", 7);
+    EXPECT_FALSE(parser.HasPending());
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Paste(std::string(
+                                           (1 << 20) - 1, 'a')));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Paste("\nb\nc\x1B[A"));
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Character('y'));
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
+TEST(Event, EscapeTimeoutConfigurable) {
+  auto event_receiver = MakeReceiver<Task>();
+  {
+    auto parser = TerminalInputParser(event_receiver->MakeSender());
+    parser.SetEscapeTimeout(10);
+    parser.Add('\x1B');
+    EXPECT_EQ(parser.TimeoutRemaining(), 10);
+    parser.Timeout(4);
+    EXPECT_EQ(parser.TimeoutRemaining(), 6);
+    parser.Timeout(5);
+    // Not dispatched before the timeout:
+    EXPECT_FALSE(event_receiver->HasPending());
+    EXPECT_TRUE(parser.HasPending());
+    parser.Timeout(1);
+    EXPECT_TRUE(event_receiver->HasPending());
+    EXPECT_FALSE(parser.HasPending());
+  }
+
+  Task received;
+  EXPECT_TRUE(event_receiver->Receive(&received));
+  EXPECT_EQ(std::get<Event>(received), Event::Escape);
+  EXPECT_FALSE(event_receiver->Receive(&received));
+}
+
+// Keys reported by the kitty keyboard protocol are translated into the
+// traditional sequences.
+TEST(Event, KittyKeyboardProtocol) {
+  struct {
+    std::string input;
+    Event expected;
+  } kTestCase[] = {
+      {"\x1B[27u", Event::Escape},
+      {"\x1B[13u", Event::Return},
+      {"\x1B[9u", Event::Tab},
+      {"\x1B[9;2u", Event::TabReverse},
+      {"\x1B[127u", Event::Backspace},
+      {"\x1B[99;5u", Event::Special({3})},
+      {"\x1B[97;3u", Event::Special("\x1B" "a")},
+      {"\x1B[97;2u", Event::Character('A')},
+      {"\x1B[97;65u", Event::Character('a')},  // With caps lock.
+      {"\x1B[97:65;2u", Event::Character('A')},
+      {"\x1B[8364u", Event::Character("\xE2\x82\xAC")},
+      {"\x1B[97;9u", Event::Special("\x1B[97;9u")},  // With super.
+      {"\x1B[?1u", Event::Special("\x1B[?1u")},      // Query reply.
+  };
+
+  for (auto test : kTestCase) {
+    auto event_receiver = MakeReceiver<Task>();
+    {
+      auto parser = TerminalInputParser(event_receiver->MakeSender());
+      parser.Add(test.input.data(), test.input.size());
+      EXPECT_FALSE(parser.HasPending());
+    }
+    Task received;
+    EXPECT_TRUE(event_receiver->Receive(&received));
+    EXPECT_EQ(std::get<Event>(received), test.expected) << test.input;
+    EXPECT_FALSE(event_receiver->Receive(&received));
+  }
+}
+
 }  // namespace ftxui
 // NOLINTEND
 
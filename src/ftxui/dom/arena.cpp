@@ -0,0 +1,111 @@
+#include "ftxui/dom/arena.hpp"
+
+#include <algorithm>  // for max
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uintptr_t
+#include <memory>     // for unique_ptr, make_unique
+#include <vector>     // for vector
+
+namespace ftxui {
+
+namespace {
+thread_local Arena* g_current = nullptr;  // NOLINT
+const size_t kBlockSize = 64 * 1024;      // NOLINT
+}  // namespace
+
+// The memory allocated between two Reset(). When it is reset while some of its
+// allocations are still alive, it is detached from the arena and deletes
+// itself once the last one is released.
+struct ArenaGeneration {
+  struct Block {
+    std::unique_ptr<char[]> data;
+    size_t size;
+  };
+  std::vector<Block> blocks;
+  size_t block = 0;  // The block being used.
+  size_t used = 0;   // The bytes used in |block|.
+  int alive = 0;     // The number of allocations not released.
+  bool detached = false;
+
+  void* Allocate(size_t size, size_t alignment) {
+    while (block < blocks.size()) {
+      const auto base = reinterpret_cast<uintptr_t>(blocks[block].data.get());
+      const uintptr_t aligned =
+          (base + used + alignment - 1) / alignment * alignment;
+      if (aligned + size <= base + blocks[block].size) {
+        used = aligned + size - base;
+        alive++;
+        return reinterpret_cast<void*>(aligned);  // NOLINT
+      }
+      block++;
+      used = 0;
+    }
+
+    // Every block is full. Add a new one, large enough.
+    const size_t block_size = std::max(kBlockSize, size + alignment);
+    blocks.push_back({std::make_unique<char[]>(block_size), block_size});
+    block = blocks.size() - 1;
+    used = 0;
+    return Allocate(size, alignment);
+  }
+};
+
+Arena::Arena() : generation_(new ArenaGeneration()) {}
+
+Arena::~Arena() {
+  if (g_current == this) {
+    g_current = nullptr;
+  }
+  if (generation_->alive == 0) {
+    delete generation_;
+  } else {
+    generation_->detached = true;
+  }
+}
+
+/// @brief Release every allocation made since the previous Reset().
+void Arena::Reset() {
+  if (generation_->alive == 0) {
+    generation_->block = 0;
+    generation_->used = 0;
+    return;
+  }
+
+  // Some elements are still alive. Their memory can't be reused.
+  generation_->detached = true;
+  generation_ = new ArenaGeneration();
+}
+
+// static
+ArenaGeneration* Arena::Current() {
+  return g_current ? g_current->generation_ : nullptr;
+}
+
+// static
+void* Arena::Allocate(ArenaGeneration* generation,
+                      size_t size,
+                      size_t alignment) {
+  return generation->Allocate(size, alignment);
+}
+
+// static
+void Arena::Release(ArenaGeneration* generation) {
+  generation->alive--;
+  if (generation->alive == 0 && generation->detached) {
+    delete generation;
+  }
+}
+
+ArenaScope::ArenaScope(Arena* arena) : previous_(g_current) {
+  g_current = arena;
+}
+
+ArenaScope::~ArenaScope() {
+  g_current = previous_;
+}
+
+}  // namespace ftxui
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
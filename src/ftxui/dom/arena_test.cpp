@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <string>  // for to_string
+
+#include "ftxui/dom/arena.hpp"     // for Arena, ArenaScope
+#include "ftxui/dom/elements.hpp"  // for text, hbox, vbox, border, bold, operator|, Element
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+Element Document() {
+  Elements lines;
+  for (int i = 0; i < 3; ++i) {
+    lines.push_back(hbox({
+        text(std::to_string(i)) | bold,
+        text("x"),
+    }));
+  }
+  return vbox(std::move(lines)) | border;
+}
+}  // namespace
+
+TEST(ArenaTest, Render) {
+  Screen expected(4, 5);
+  Render(expected, Document());
+
+  Arena arena;
+  for (int frame = 0; frame < 3; ++frame) {
+    Screen screen(4, 5);
+    {
+      ArenaScope scope(&arena);
+      Render(screen, Document());
+    }
+    arena.Reset();
+    EXPECT_EQ(screen.ToString(), expected.ToString());
+  }
+}
+
+TEST(ArenaTest, MemoryIsReused) {
+  Arena arena;
+  Node* first = nullptr;
+  {
+    ArenaScope scope(&arena);
+    first = text("a").get();
+  }
+  arena.Reset();
+  {
+    ArenaScope scope(&arena);
+    EXPECT_EQ(text("b").get(), first);
+  }
+}
+
+TEST(ArenaTest, ElementOutlivingTheFrame) {
+  Arena arena;
+  Element kept;
+  {
+    ArenaScope scope(&arena);
+    kept = hbox({text("kept")});
+  }
+  arena.Reset();
+
+  // The memory of |kept| isn't reused by the next frame.
+  {
+    ArenaScope scope(&arena);
+    auto other = hbox({text("other")});
+    Screen screen(5, 1);
+    Render(screen, other);
+    EXPECT_EQ(screen.ToString(), "other");
+  }
+  arena.Reset();
+
+  Screen screen(4, 1);
+  Render(screen, kept);
+  EXPECT_EQ(screen.ToString(), "kept");
+}
+
+TEST(ArenaTest, ElementOutlivingTheArena) {
+  Element kept;
+  {
+    Arena arena;
+    ArenaScope scope(&arena);
+    kept = text("kept");
+  }
+  Screen screen(4, 1);
+  Render(screen, kept);
+  EXPECT_EQ(screen.ToString(), "kept");
+}
+
+TEST(ArenaTest, NestedScope) {
+  Arena a;
+  Arena b;
+  Node* from_a = nullptr;
+  {
+    ArenaScope scope_a(&a);
+    {
+      ArenaScope scope_b(&b);
+      auto element = text("b");
+    }
+    from_a = text("a").get();
+  }
+  b.Reset();
+  a.Reset();
+  {
+    ArenaScope scope(&a);
+    EXPECT_EQ(text("a").get(), from_a);
+  }
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
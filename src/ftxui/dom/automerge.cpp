@@ -1,6 +1,7 @@
-#include <memory>   // for make_shared
+#include <memory>   // for shared_ptr
 #include <utility>  // for move
 
+#include "ftxui/dom/arena.hpp"           // for MakeNode
 #include "ftxui/dom/elements.hpp"        // for Element, automerge
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
@@ -17,16 +18,18 @@ Element automerge(Element child) {
     using NodeDecorator::NodeDecorator;
 
     void Render(Screen& screen) override {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          screen.PixelAt(x, y).automerge = true;
+      const Box box = Box::Intersection(box_, screen.stencil);
+      for (int y = box.y_min; y <= box.y_max; ++y) {
+        for (int x = box.x_min; x <= box.x_max; ++x) {
+          screen.PixelAtRegistered(x, y).automerge = true;
         }
       }
+      screen.RegisterAutomerge(box);
       Node::Render(screen);
     }
   };
 
-  return std::make_shared<Impl>(std::move(child));
+  return MakeNode<Impl>(std::move(child));
 }
 
 }  // namespace ftxui
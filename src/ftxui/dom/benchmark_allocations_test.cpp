@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include <atomic>    // for atomic
+#include <cstdlib>   // for malloc, free
+#include <new>       // for bad_alloc
+#include <optional>  // for optional
+#include <string>    // for to_string
+#include <utility>   // for move
+
+#include "ftxui/dom/arena.hpp"  // for Arena, ArenaScope
+#include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, border, inverted, bold, color, size, flex
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+
+// This replaces the global operator new of the whole executable. It lives in
+// its own executable, so that it doesn't slow down the other benchmarks.
+
+// Count the allocations from the global heap. Not inlined, so that the compiler
+// doesn't pair malloc with delete.
+static std::atomic<size_t> g_allocations{0};
+
+#if defined(__GNUC__)
+#define FTXUI_NOINLINE __attribute__((noinline))
+#else
+#define FTXUI_NOINLINE
+#endif
+
+FTXUI_NOINLINE void* operator new(size_t size) {
+  g_allocations++;
+  if (void* p = std::malloc(size)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+FTXUI_NOINLINE void operator delete(void* p) noexcept {
+  std::free(p);
+}
+FTXUI_NOINLINE void operator delete(void* p, size_t) noexcept {
+  std::free(p);
+}
+
+namespace ftxui {
+
+// The number of allocations from the global heap to build, lay out and draw a
+// frame, with and without an arena. With the arena, what remains are the 21
+// Elements lists built by |document| itself.
+static void BenchmarkFrameAllocations(benchmark::State& state) {
+  const bool use_arena = state.range(0);
+  auto document = [] {
+    Elements lines;
+    lines.reserve(20);
+    for (int i = 0; i < 20; ++i) {
+      lines.push_back(hbox({
+          text(std::to_string(i)) | bold | size(WIDTH, EQUAL, 4),
+          separator(),
+          gauge(i / 20.f) | color(Color::Green) | flex,
+          text("OK") | inverted,
+      }));
+    }
+    return vbox(std::move(lines)) | border;
+  };
+
+  Arena arena;
+  Screen screen(80, 24);
+  size_t allocations = 0;
+  for (auto _ : state) {
+    const size_t before = g_allocations;
+    {
+      std::optional<ArenaScope> scope;
+      if (use_arena) {
+        scope.emplace(&arena);
+      }
+      Render(screen, document());
+    }
+    arena.Reset();
+    allocations += g_allocations - before;
+  }
+  state.counters["allocations"] =
+      benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BenchmarkFrameAllocations)->Arg(0)->Arg(1);
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
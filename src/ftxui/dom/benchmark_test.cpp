@@ -1,10 +1,28 @@
 #include <benchmark/benchmark.h>
+#include <algorithm>           // for min
+#include <condition_variable>  // for condition_variable
+#include <functional>          // for function
+#include <mutex>               // for mutex, unique_lock
+#include <queue>               // for queue
+#include <string>              // for string
+#include <thread>              // for thread
+#include <vector>              // for vector
+
+#include "ftxui/component/component.hpp"  // for Container, Renderer, CatchEvent, Keymap
+#include "ftxui/component/event.hpp"     // for Event
+#include "ftxui/component/receiver.hpp"  // for MakeReceiver, Sender
+#include "ftxui/component/task.hpp"      // for Task
+#include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
 
 #include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted
+#include "ftxui/dom/iteration_counter_test.hpp"  // for IterationCounter
 #include "ftxui/dom/node.hpp"      // for Render
+#include "ftxui/screen/color.hpp"   // for Color
 #include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/screen/string.hpp"  // for string_width
 
 // NOLINTBEGIN
+
 namespace ftxui {
 
 static void BencharkBasic(benchmark::State& state) {
@@ -30,6 +48,463 @@ static void BencharkBasic(benchmark::State& state) {
 }
 BENCHMARK(BencharkBasic)->DenseRange(0, 256, 16);
 
+// A dashboard, using many colors and styles.
+static Screen RenderDashboard() {
+  Elements rows;
+  for (int y = 0; y < 40; ++y) {
+    Elements cells;
+    for (int x = 0; x < 8; ++x) {
+      const int i = x + 8 * y;
+      auto cell = text(" " + std::to_string(i * 37 % 1000) + " ") |
+                  color(Color::Palette256(16 + i % 200)) |
+                  bgcolor(Color::Palette256(232 + i % 24));
+      if (i % 3 == 0) {
+        cell |= bold;
+      }
+      if (i % 5 == 0) {
+        cell |= underlined;
+      }
+      cells.push_back(cell);
+      cells.push_back(gauge(float(i % 10) / 10.f) |
+                      color(Color::RGB(i % 256, 128, 255 - i % 256)) | flex);
+    }
+    rows.push_back(hbox(std::move(cells)));
+  }
+  Screen screen(160, 40);
+  Render(screen, vbox(std::move(rows)));
+  return screen;
+}
+
+// The SGR encoding used before merging the attributes into a single sequence:
+// one sequence per attribute, and both colors whenever one of them changes.
+static void LegacyUpdatePixelStyle(std::string& out,
+                                   Pixel& previous,
+                                   const Pixel& next) {
+  if (next == previous) {
+    return;
+  }
+  if ((!next.bold && previous.bold) || (!next.dim && previous.dim)) {
+    out += "\x1B[22m";
+    previous.bold = false;
+    previous.dim = false;
+  }
+  if ((!next.underlined && previous.underlined) ||
+      (!next.underlined_double && previous.underlined_double)) {
+    out += "\x1B[24m";
+    previous.underlined = false;
+    previous.underlined_double = false;
+  }
+  if (next.bold && !previous.bold) out += "\x1B[1m";
+  if (next.dim && !previous.dim) out += "\x1B[2m";
+  if (next.underlined && !previous.underlined) out += "\x1B[4m";
+  if (next.blink && !previous.blink) out += "\x1B[5m";
+  if (!next.blink && previous.blink) out += "\x1B[25m";
+  if (next.inverted && !previous.inverted) out += "\x1B[7m";
+  if (!next.inverted && previous.inverted) out += "\x1B[27m";
+  if (next.strikethrough && !previous.strikethrough) out += "\x1B[9m";
+  if (!next.strikethrough && previous.strikethrough) out += "\x1B[29m";
+  if (next.underlined_double && !previous.underlined_double)
+    out += "\x1B[21m";
+  if (next.foreground_color != previous.foreground_color ||
+      next.background_color != previous.background_color) {
+    out += "\x1B[" + next.foreground_color.Print(false) + "m";
+    out += "\x1B[" + next.background_color.Print(true) + "m";
+  }
+  previous = next;
+}
+
+static void LegacyEncode(const Screen& screen, std::string& out) {
+  Pixel previous;
+  const Pixel final_pixel;
+  for (int y = 0; y < screen.dimy(); ++y) {
+    if (y != 0) {
+      LegacyUpdatePixelStyle(out, previous, final_pixel);
+      out += "\r\n";
+    }
+    bool previous_fullwidth = false;
+    const Pixel* line = screen.LineAt(y);
+    for (int x = 0; x < screen.dimx(); ++x) {
+      if (!previous_fullwidth) {
+        LegacyUpdatePixelStyle(out, previous, line[x]);
+        line[x].character.AppendTo(out);
+      }
+      previous_fullwidth = string_width(line[x].character.str()) == 2;
+    }
+  }
+  LegacyUpdatePixelStyle(out, previous, final_pixel);
+}
+
+static void BenchmarkEncodeLegacy(benchmark::State& state) {
+  const Screen screen = RenderDashboard();
+  std::string out;
+  for (auto _ : state) {
+    out.clear();
+    LegacyEncode(screen, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.counters["bytes_per_frame"] = double(out.size());
+}
+BENCHMARK(BenchmarkEncodeLegacy);
+
+static void BenchmarkEncode(benchmark::State& state) {
+  const Screen screen = RenderDashboard();
+  std::string out;
+  for (auto _ : state) {
+    out.clear();
+    screen.Encode(out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.counters["bytes_per_frame"] = double(out.size());
+}
+BENCHMARK(BenchmarkEncode);
+
+// The mutex based queue ReceiverImpl used to be, for comparison.
+class LegacyReceiver {
+ public:
+  void Send(int value) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      queue_.push(value);
+    }
+    notifier_.notify_one();
+  }
+
+  bool ReceiveNonBlocking(int* value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return false;
+    }
+    *value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::queue<int> queue_;
+  std::condition_variable notifier_;
+};
+
+constexpr int kItemsPerProducer = 10000;
+
+// |state.range(0)| threads send items, while the consumer receives them.
+static void BenchmarkReceiverLegacy(benchmark::State& state) {
+  const int producers = state.range(0);
+  for (auto _ : state) {
+    LegacyReceiver receiver;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producers; ++i) {
+      threads.emplace_back([&] {
+        for (int j = 0; j < kItemsPerProducer; ++j) {
+          receiver.Send(j);
+        }
+      });
+    }
+    int received = 0;
+    int value = 0;
+    while (received < producers * kItemsPerProducer) {
+      while (receiver.ReceiveNonBlocking(&value)) {
+        received++;
+      }
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * producers * kItemsPerProducer);
+}
+BENCHMARK(BenchmarkReceiverLegacy)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+static void BenchmarkReceiver(benchmark::State& state) {
+  const int producers = state.range(0);
+  std::vector<int> values;
+  for (auto _ : state) {
+    auto receiver = MakeReceiver<int>();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producers; ++i) {
+      threads.emplace_back([sender = receiver->MakeSender()] {
+        for (int j = 0; j < kItemsPerProducer; ++j) {
+          sender->Send(j);
+        }
+      });
+    }
+    size_t received = 0;
+    while (received < size_t(producers * kItemsPerProducer)) {
+      values.clear();
+      receiver->ReceiveAll(&values);
+      received += values.size();
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * producers * kItemsPerProducer);
+}
+BENCHMARK(BenchmarkReceiver)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+// Feed |input| to the TerminalInputParser, in chunks of the size read from the
+// terminal.
+static void BenchmarkParser(benchmark::State& state, const std::string& input) {
+  const size_t chunk = 4096;
+  auto receiver = MakeReceiver<Task>();
+  auto parser = TerminalInputParser(receiver->MakeSender());
+  std::vector<Task> tasks;
+  for (auto _ : state) {
+    for (size_t i = 0; i < input.size(); i += chunk) {
+      parser.Add(input.data() + i, std::min(chunk, input.size() - i));
+    }
+    tasks.clear();
+    receiver->ReceiveAll(&tasks);
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+static void BenchmarkParserPaste(benchmark::State& state) {
+  std::string input;
+  while (input.size() < 1 << 20) {
+    input += "The quick brown fox jumps over the lazy dog. ";
+  }
+  BenchmarkParser(state, input);
+}
+BENCHMARK(BenchmarkParserPaste);
+
+static void BenchmarkParserBracketedPaste(benchmark::State& state) {
+  // Below the 1MiB a paste event holds at most, so that it isn't split.
+  std::string input = "\x1B[200~";
+  while (input.size() < (1 << 20) - 64) {  // NOLINT
+    input += "The quick brown fox jumps over the lazy dog. ";
+  }
+  input += "\x1B[201~";
+  BenchmarkParser(state, input);
+}
+BENCHMARK(BenchmarkParserBracketedPaste);
+
+static void BenchmarkParserMouse(benchmark::State& state) {
+  std::string input;
+  while (input.size() < 1 << 20) {
+    input += "\x1B[<32;123;45M";
+  }
+  BenchmarkParser(state, input);
+}
+BENCHMARK(BenchmarkParserMouse);
+
+static void BenchmarkParserOSC(benchmark::State& state) {
+  std::string input = "\x1B]52;c;";
+  while (input.size() < 1 << 20) {
+    input += "YWJjZGVm";
+  }
+  input += "\x1B\\";
+  BenchmarkParser(state, input);
+}
+BENCHMARK(BenchmarkParserOSC);
+
+// Dispatch events through a chain of |depth| containers.
+static void BenchmarkEventDispatch(benchmark::State& state) {
+  Component component = Renderer([] { return text("leaf"); });
+  for (int i = 0; i < state.range(0); ++i) {
+    component = Container::Vertical({component});
+  }
+  const Event events[] = {
+      Event::ArrowDown,
+      Event::Special("\x1B[1;5B"),
+      Event::Character('a'),
+  };
+  for (auto _ : state) {
+    for (const Event& event : events) {
+      benchmark::DoNotOptimize(component->OnEvent(event));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 3);
+}
+BENCHMARK(BenchmarkEventDispatch)->Arg(1)->Arg(8)->Arg(64);
+
+// Dispatch an event not bound, with |range(0)| bindings checked in a chain of
+// comparisons.
+static void BenchmarkCatchEventBindings(benchmark::State& state) {
+  std::vector<Event> keys;
+  for (int i = 0; i < state.range(0); ++i) {
+    keys.push_back(Event::Character("k" + std::to_string(i)));
+  }
+  int triggered = 0;
+  auto component = CatchEvent(Renderer([] { return text(""); }),
+                              [&](const Event& event) {
+                                for (const Event& key : keys) {
+                                  if (event == key) {
+                                    triggered++;
+                                    return true;
+                                  }
+                                }
+                                return false;
+                              });
+  const Event event = Event::Character('a');
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(component->OnEvent(event));
+  }
+}
+BENCHMARK(BenchmarkCatchEventBindings)->Arg(10)->Arg(100)->Arg(1000);
+
+// Same, using a Keymap.
+static void BenchmarkKeymapBindings(benchmark::State& state) {
+  KeyBindings bindings;
+  int triggered = 0;
+  for (int i = 0; i < state.range(0); ++i) {
+    bindings.Bind(Event::Character("k" + std::to_string(i)),
+                  [&] { triggered++; });
+  }
+  auto component = Keymap(Renderer([] { return text(""); }), bindings);
+  const Event event = Event::Character('a');
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(component->OnEvent(event));
+  }
+}
+BENCHMARK(BenchmarkKeymapBindings)->Arg(10)->Arg(100)->Arg(1000);
+
+// Render a long decorated list through a small frame. Only the visible rows
+// are drawn, so the cost of Render shouldn't depend on the number of rows.
+static void BenchmarkFrameRender(benchmark::State& state) {
+  Elements lines;
+  for (int i = 0; i < state.range(0); ++i) {
+    lines.push_back(text("line " + std::to_string(i)) | bold |
+                    color(Color::Red));
+  }
+  lines[state.range(0) / 2] |= focus;
+  auto document = vbox(std::move(lines)) | bgcolor(Color::Blue) | frame;
+  auto screen = Screen(80, 24);
+  Render(screen, document);
+  for (auto _ : state) {
+    screen.Clear();
+    document->Render(screen);
+  }
+}
+BENCHMARK(BenchmarkFrameRender)->Arg(100)->Arg(10000)->Arg(50000);
+
+// Build, layout and draw a scrolled list, like a component does every frame.
+static void BenchmarkListVBox(benchmark::State& state) {
+  const int count = state.range(0);
+  auto screen = Screen(80, 24);
+  for (auto _ : state) {
+    Elements lines;
+    for (int i = 0; i < count; ++i) {
+      auto line = text("line " + std::to_string(i));
+      if (i == count / 2) {
+        line |= focus;
+      }
+      lines.push_back(std::move(line));
+    }
+    Render(screen, vbox(std::move(lines)) | frame);
+  }
+}
+BENCHMARK(BenchmarkListVBox)->Arg(100)->Arg(10000)->Arg(100000);
+
+static void BenchmarkListVirtual(benchmark::State& state) {
+  const int count = state.range(0);
+  auto screen = Screen(80, 24);
+  for (auto _ : state) {
+    auto row = [&](size_t i) {
+      auto line = text("line " + std::to_string(i));
+      if (int(i) == count / 2) {
+        line |= focus;
+      }
+      return line;
+    };
+    Render(screen, virtualList(count, 1, row, count / 2) | frame);
+  }
+}
+BENCHMARK(BenchmarkListVirtual)->Arg(100)->Arg(10000)->Arg(1000000);
+
+static void BenchmarkLayoutIterations(benchmark::State& state,
+                                      const std::function<Element()>& build) {
+  auto screen = Screen(80, 1000);
+  int iterations = 0;
+  for (auto _ : state) {
+    auto document = std::make_shared<IterationCounter>(build(), &iterations);
+    Render(screen, document);
+  }
+  state.counters["iterations"] = iterations;
+}
+
+static void BenchmarkLayoutParagraph(benchmark::State& state) {
+  std::string words;
+  for (int i = 0; i < 60; ++i) {
+    words += "lorem ipsum ";
+  }
+  BenchmarkLayoutIterations(state, [&] {
+    Elements paragraphs;
+    for (int i = 0; i < 20; ++i) {
+      paragraphs.push_back(paragraph(words));
+      paragraphs.push_back(separator());
+    }
+    return vbox(std::move(paragraphs)) | border;
+  });
+}
+BENCHMARK(BenchmarkLayoutParagraph);
+
+static void BenchmarkLayoutHflow(benchmark::State& state) {
+  BenchmarkLayoutIterations(state, [] {
+    Elements flows;
+    for (int i = 0; i < 20; ++i) {
+      Elements items;
+      for (int j = 0; j < 30; ++j) {
+        items.push_back(text("item " + std::to_string(j)) | border);
+      }
+      flows.push_back(hflow(std::move(items)) | border);
+    }
+    return vbox(std::move(flows));
+  });
+}
+BENCHMARK(BenchmarkLayoutHflow);
+
+// A help page, made of many paragraphs, drawn on every frame.
+static std::vector<std::string> HelpPage() {
+  std::vector<std::string> page;
+  for (int i = 0; i < 100; ++i) {
+    std::string paragraph = "Option " + std::to_string(i) + ":";
+    for (int j = 0; j < 40; ++j) {
+      paragraph += " word" + std::to_string((i * 7 + j) % 13);
+    }
+    page.push_back(paragraph);
+  }
+  return page;
+}
+
+static void BenchmarkParagraphHelpPage(benchmark::State& state) {
+  const auto page = HelpPage();
+  auto screen = Screen(80, 1000);
+  for (auto _ : state) {
+    Elements paragraphs;
+    for (const auto& it : page) {
+      paragraphs.push_back(paragraphAlignJustify(it));
+    }
+    Render(screen, vbox(std::move(paragraphs)));
+  }
+}
+BENCHMARK(BenchmarkParagraphHelpPage);
+
+// The same help page, with the words laid out by a flexbox.
+static void BenchmarkParagraphHelpPageFlexbox(benchmark::State& state) {
+  const auto page = HelpPage();
+  auto screen = Screen(80, 1000);
+  for (auto _ : state) {
+    Elements paragraphs;
+    for (const auto& it : page) {
+      Elements words;
+      size_t begin = 0;
+      while (begin <= it.size()) {
+        size_t end = std::min(it.find(' ', begin), it.size());
+        words.push_back(text(it.substr(begin, end - begin)));
+        begin = end + 1;
+      }
+      words.push_back(text("") | xflex);
+      paragraphs.push_back(flexbox(
+          std::move(words),
+          FlexboxConfig().SetGap(1, 0).Set(
+              FlexboxConfig::JustifyContent::SpaceBetween)));
+    }
+    Render(screen, vbox(std::move(paragraphs)));
+  }
+}
+BENCHMARK(BenchmarkParagraphHelpPageFlexbox);
+
 }  // namespace ftxui
 // NOLINTEND
 
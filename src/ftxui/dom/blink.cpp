@@ -1,6 +1,7 @@
-#include <memory>   // for make_shared
+#include <memory>   // for shared_ptr
 #include <utility>  // for move
 
+#include "ftxui/dom/arena.hpp"           // for MakeNode
 #include "ftxui/dom/elements.hpp"        // for Element, blink
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
@@ -15,9 +16,10 @@ class Blink : public NodeDecorator {
 
   void Render(Screen& screen) override {
     Node::Render(screen);
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).blink = true;
+    const Box box = Box::Intersection(box_, screen.stencil);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        screen.PixelAtRegistered(x, y).blink = true;
       }
     }
   }
@@ -26,7 +28,7 @@ class Blink : public NodeDecorator {
 /// @brief The text drawn alternates in between visible and hidden.
 /// @ingroup dom
 Element blink(Element child) {
-  return std::make_shared<Blink>(std::move(child));
+  return MakeNode<Blink>(std::move(child));
 }
 
 }  // namespace ftxui
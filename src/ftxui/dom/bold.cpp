@@ -1,6 +1,7 @@
-#include <memory>   // for make_shared
+#include <memory>   // for shared_ptr
 #include <utility>  // for move
 
+#include "ftxui/dom/arena.hpp"           // for MakeNode
 #include "ftxui/dom/elements.hpp"        // for Element, bold
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
@@ -14,9 +15,10 @@ class Bold : public NodeDecorator {
   using NodeDecorator::NodeDecorator;
 
   void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).bold = true;
+    const Box box = Box::Intersection(box_, screen.stencil);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        screen.PixelAtRegistered(x, y).bold = true;
       }
     }
     Node::Render(screen);
@@ -26,7 +28,7 @@ class Bold : public NodeDecorator {
 /// @brief Use a bold font, for elements with more emphasis.
 /// @ingroup dom
 Element bold(Element child) {
-  return std::make_shared<Bold>(std::move(child));
+  return MakeNode<Bold>(std::move(child));
 }
 
 }  // namespace ftxui
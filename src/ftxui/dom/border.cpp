@@ -1,12 +1,13 @@
 #include <algorithm>               // for max
 #include <array>                   // for array
 #include <ftxui/screen/color.hpp>  // for Color
-#include <memory>    // for allocator, make_shared, __shared_ptr_access
+#include <memory>    // for allocator, __shared_ptr_access
 #include <optional>  // for optional, nullopt
 #include <string>    // for basic_string, string
 #include <utility>   // for move
 #include <vector>    // for __alloc_traits<>::value_type
 
+#include "ftxui/dom/arena.hpp"     // for MakeNode
 #include "ftxui/dom/elements.hpp"  // for unpack, Element, Decorator, BorderStyle, ROUNDED, borderStyled, Elements, DASHED, DOUBLE, EMPTY, HEAVY, LIGHT, border, borderDashed, borderDouble, borderEmpty, borderHeavy, borderLight, borderRounded, borderWith, window
 #include "ftxui/dom/node.hpp"      // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
@@ -27,6 +28,14 @@ static Charsets simple_border_charset = {
     Charset{" ", " ", " ", " ", " ", " "},  // EMPTY
 };
 
+// Only the edges of the border can be merged with the other elements.
+static void RegisterAutomergeEdges(Screen& screen, const Box& box) {
+  screen.RegisterAutomerge({box.x_min, box.x_max, box.y_min, box.y_min});
+  screen.RegisterAutomerge({box.x_min, box.x_max, box.y_max, box.y_max});
+  screen.RegisterAutomerge({box.x_min, box.x_min, box.y_min, box.y_max});
+  screen.RegisterAutomerge({box.x_max, box.x_max, box.y_min, box.y_max});
+}
+
 // For reference, here is the charset for normal border:
 class Border : public Node {
  public:
@@ -36,12 +45,21 @@ class Border : public Node {
       : Node(std::move(children)),
         charset_(simple_border_charset[style]),
         foreground_color_(foreground_color) {}  // NOLINT
+  Border(Element child,
+         BorderStyle style,
+         std::optional<Color> foreground_color = std::nullopt)
+      : Node(std::move(child)),
+        charset_(simple_border_charset[style]),
+        foreground_color_(foreground_color) {}  // NOLINT
 
   const Charset& charset_;  // NOLINT
   std::optional<Color> foreground_color_;
 
   void ComputeRequirement() override {
-    Node::ComputeRequirement();
+    for (auto& child : children_) {
+      child->SetAvailableWidth(std::max(0, available_width_ - 2));
+      child->ComputeRequirement();
+    }
     requirement_ = children_[0]->requirement();
     requirement_.min_x += 2;
     requirement_.min_y += 2;
@@ -87,21 +105,22 @@ class Border : public Node {
     screen.at(box_.x_max, box_.y_max) = charset_[3];  // NOLINT
 
     for (int x = box_.x_min + 1; x < box_.x_max; ++x) {
-      Pixel& p1 = screen.PixelAt(x, box_.y_min);
-      Pixel& p2 = screen.PixelAt(x, box_.y_max);
+      Pixel& p1 = screen.PixelAtRegistered(x, box_.y_min);
+      Pixel& p2 = screen.PixelAtRegistered(x, box_.y_max);
       p1.character = charset_[4];  // NOLINT
       p2.character = charset_[4];  // NOLINT
       p1.automerge = true;
       p2.automerge = true;
     }
     for (int y = box_.y_min + 1; y < box_.y_max; ++y) {
-      Pixel& p3 = screen.PixelAt(box_.x_min, y);
-      Pixel& p4 = screen.PixelAt(box_.x_max, y);
+      Pixel& p3 = screen.PixelAtRegistered(box_.x_min, y);
+      Pixel& p4 = screen.PixelAtRegistered(box_.x_max, y);
       p3.character = charset_[5];  // NOLINT
       p4.character = charset_[5];  // NOLINT
       p3.automerge = true;
       p4.automerge = true;
     }
+    RegisterAutomergeEdges(screen, box_);
 
     // Draw title.
     if (children_.size() == 2) {
@@ -111,12 +130,16 @@ class Border : public Node {
     // Draw the border color.
     if (foreground_color_) {
       for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, box_.y_min).foreground_color = *foreground_color_;
-        screen.PixelAt(x, box_.y_max).foreground_color = *foreground_color_;
+        screen.PixelAtRegistered(x, box_.y_min).foreground_color =
+            *foreground_color_;
+        screen.PixelAtRegistered(x, box_.y_max).foreground_color =
+            *foreground_color_;
       }
       for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        screen.PixelAt(box_.x_min, y).foreground_color = *foreground_color_;
-        screen.PixelAt(box_.x_max, y).foreground_color = *foreground_color_;
+        screen.PixelAtRegistered(box_.x_min, y).foreground_color =
+            *foreground_color_;
+        screen.PixelAtRegistered(box_.x_max, y).foreground_color =
+            *foreground_color_;
       }
     }
   }
@@ -125,14 +148,17 @@ class Border : public Node {
 // For reference, here is the charset for normal border:
 class BorderPixel : public Node {
  public:
-  BorderPixel(Elements children, Pixel pixel)
-      : Node(std::move(children)), pixel_(std::move(pixel)) {}
+  BorderPixel(Element child, Pixel pixel)
+      : Node(std::move(child)), pixel_(std::move(pixel)) {}
 
  private:
   Pixel pixel_;
 
   void ComputeRequirement() override {
-    Node::ComputeRequirement();
+    for (auto& child : children_) {
+      child->SetAvailableWidth(std::max(0, available_width_ - 2));
+      child->ComputeRequirement();
+    }
     requirement_ = children_[0]->requirement();
     requirement_.min_x += 2;
     requirement_.min_y += 2;
@@ -172,19 +198,20 @@ class BorderPixel : public Node {
       return;
     }
 
-    screen.PixelAt(box_.x_min, box_.y_min) = pixel_;
-    screen.PixelAt(box_.x_max, box_.y_min) = pixel_;
-    screen.PixelAt(box_.x_min, box_.y_max) = pixel_;
-    screen.PixelAt(box_.x_max, box_.y_max) = pixel_;
+    screen.PixelAtRegistered(box_.x_min, box_.y_min) = pixel_;
+    screen.PixelAtRegistered(box_.x_max, box_.y_min) = pixel_;
+    screen.PixelAtRegistered(box_.x_min, box_.y_max) = pixel_;
+    screen.PixelAtRegistered(box_.x_max, box_.y_max) = pixel_;
 
     for (int x = box_.x_min + 1; x < box_.x_max; ++x) {
-      screen.PixelAt(x, box_.y_min) = pixel_;
-      screen.PixelAt(x, box_.y_max) = pixel_;
+      screen.PixelAtRegistered(x, box_.y_min) = pixel_;
+      screen.PixelAtRegistered(x, box_.y_max) = pixel_;
     }
     for (int y = box_.y_min + 1; y < box_.y_max; ++y) {
-      screen.PixelAt(box_.x_min, y) = pixel_;
-      screen.PixelAt(box_.x_max, y) = pixel_;
+      screen.PixelAtRegistered(box_.x_min, y) = pixel_;
+      screen.PixelAtRegistered(box_.x_max, y) = pixel_;
     }
+    RegisterAutomergeEdges(screen, box_);
   }
 };
 
@@ -220,7 +247,7 @@ class BorderPixel : public Node {
 /// └───────────┘
 /// ```
 Element border(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), ROUNDED);
+  return MakeNode<Border>(std::move(child), ROUNDED);
 }
 
 /// @brief Same as border but with a constant Pixel around the element.
@@ -228,7 +255,7 @@ Element border(Element child) {
 /// @see border
 Decorator borderWith(const Pixel& pixel) {
   return [pixel](Element child) {
-    return std::make_shared<BorderPixel>(unpack(std::move(child)), pixel);
+    return MakeNode<BorderPixel>(std::move(child), pixel);
   };
 }
 
@@ -237,7 +264,7 @@ Decorator borderWith(const Pixel& pixel) {
 /// @see border
 Decorator borderStyled(BorderStyle style) {
   return [style](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), style);
+    return MakeNode<Border>(std::move(child), style);
   };
 }
 
@@ -246,8 +273,8 @@ Decorator borderStyled(BorderStyle style) {
 /// @see border
 Decorator borderStyled(Color foreground_color) {
   return [foreground_color](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), ROUNDED,
-                                    foreground_color);
+    return MakeNode<Border>(std::move(child), ROUNDED,
+                            foreground_color);
   };
 }
 
@@ -256,8 +283,7 @@ Decorator borderStyled(Color foreground_color) {
 /// @see border
 Decorator borderStyled(BorderStyle style, Color foreground_color) {
   return [style, foreground_color](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), style,
-                                    foreground_color);
+    return MakeNode<Border>(std::move(child), style, foreground_color);
   };
 }
 
@@ -293,7 +319,7 @@ Decorator borderStyled(BorderStyle style, Color foreground_color) {
 /// ┗╍╍╍╍╍╍╍╍╍╍╍╍╍╍┛
 /// ```
 Element borderDashed(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), DASHED);
+  return MakeNode<Border>(std::move(child), DASHED);
 }
 
 /// @brief Draw a dashed border around the element.
@@ -328,7 +354,7 @@ Element borderDashed(Element child) {
 /// └──────────────┘
 /// ```
 Element borderLight(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), LIGHT);
+  return MakeNode<Border>(std::move(child), LIGHT);
 }
 
 /// @brief Draw a heavy border around the element.
@@ -363,7 +389,7 @@ Element borderLight(Element child) {
 /// ┗━━━━━━━━━━━━━━┛
 /// ```
 Element borderHeavy(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), HEAVY);
+  return MakeNode<Border>(std::move(child), HEAVY);
 }
 
 /// @brief Draw a double border around the element.
@@ -398,7 +424,7 @@ Element borderHeavy(Element child) {
 /// ╚══════════════╝
 /// ```
 Element borderDouble(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), DOUBLE);
+  return MakeNode<Border>(std::move(child), DOUBLE);
 }
 
 /// @brief Draw a rounded border around the element.
@@ -433,7 +459,7 @@ Element borderDouble(Element child) {
 /// ╰──────────────╯
 /// ```
 Element borderRounded(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), ROUNDED);
+  return MakeNode<Border>(std::move(child), ROUNDED);
 }
 
 /// @brief Draw an empty border around the element.
@@ -468,7 +494,7 @@ Element borderRounded(Element child) {
 ///
 /// ```
 Element borderEmpty(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)), EMPTY);
+  return MakeNode<Border>(std::move(child), EMPTY);
 }
 
 /// @brief Draw window with a title and a border around the element.
@@ -493,8 +519,8 @@ Element borderEmpty(Element child) {
 /// └───────┘
 /// ```
 Element window(Element title, Element content) {
-  return std::make_shared<Border>(unpack(std::move(content), std::move(title)),
-                                  ROUNDED);
+  return MakeNode<Border>(unpack(std::move(content), std::move(title)),
+                          ROUNDED);
 }
 }  // namespace ftxui
 
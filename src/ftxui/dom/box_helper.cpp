@@ -8,7 +8,7 @@ namespace {
 // Called when the size allowed is greater than the requested size. This
 // distributes the extra spaces toward the flexible elements, in relative
 // proportions.
-void ComputeGrow(std::vector<Element>* elements,
+void ComputeGrow(Elements* elements,
                  int extra_space,
                  int flex_grow_sum) {
   for (Element& element : *elements) {
@@ -23,7 +23,7 @@ void ComputeGrow(std::vector<Element>* elements,
 // Called when the size allowed is lower than the requested size, and the
 // shrinkable element can absorbe the (negative) extra_space. This distribute
 // the extra_space toward those.
-void ComputeShrinkEasy(std::vector<Element>* elements,
+void ComputeShrinkEasy(Elements* elements,
                        int extra_space,
                        int flex_shrink_sum) {
   for (Element& element : *elements) {
@@ -39,7 +39,7 @@ void ComputeShrinkEasy(std::vector<Element>* elements,
 // shrinkable element can not absorbe the (negative) extra_space. This assign
 // zero to shrinkable elements and distribute the remaining (negative)
 // extra_space toward the other non shrinkable elements.
-void ComputeShrinkHard(std::vector<Element>* elements,
+void ComputeShrinkHard(Elements* elements,
                        int extra_space,
                        int size) {
   for (Element& element : *elements) {
@@ -58,7 +58,7 @@ void ComputeShrinkHard(std::vector<Element>* elements,
 
 }  // namespace
 
-void Compute(std::vector<Element>* elements, int target_size) {
+void Compute(Elements* elements, int target_size) {
   int size = 0;
   int flex_grow_sum = 0;
   int flex_shrink_sum = 0;
@@ -3,6 +3,8 @@
 
 #include <vector>
 
+#include "ftxui/dom/arena.hpp"  // for ArenaAllocator
+
 namespace ftxui {
 namespace box_helper {
 
@@ -16,7 +18,10 @@ struct Element {
   int size = 0;
 };
 
-void Compute(std::vector<Element>* elements, int target_size);
+// Scratch memory of the layout, taken from the frame arena when there is one.
+using Elements = std::vector<Element, ArenaAllocator<Element>>;
+
+void Compute(Elements* elements, int target_size);
 
 }  // namespace box_helper
 }  // namespace ftxui
@@ -6,14 +6,16 @@
 #include <cstdlib>                 // for abs
 #include <ftxui/screen/color.hpp>  // for Color
 #include <map>                     // for map
-#include <memory>                  // for make_shared
+#include <memory>                  // for shared_ptr
 #include <utility>                 // for move, pair
 #include <vector>                  // for vector
 
+#include "ftxui/dom/arena.hpp"        // for MakeNode
 #include "ftxui/dom/elements.hpp"     // for Element, canvas
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/glyph.hpp"     // for Glyph
 #include "ftxui/screen/screen.hpp"    // for Pixel, Screen
 #include "ftxui/screen/string.hpp"    // for Utf8ToGlyphs
 #include "ftxui/util/ref.hpp"         // for ConstRef
@@ -22,10 +24,7 @@ namespace ftxui {
 
 namespace {
 
-// Base UTF8 pattern:
-// 11100010 10100000 10000000 // empty
-
-// Pattern for the individuel dots:
+// Braille patterns are the codepoints U+2800 + a bit per dot:
 // ┌──────┬───────┐
 // │dot1  │ dot4  │
 // ├──────┼───────┤
@@ -35,28 +34,21 @@ namespace {
 // ├──────┼───────┤
 // │dot0-1│ dot0-2│
 // └──────┴───────┘
-// 11100010 10100000 10000001 // dot1
-// 11100010 10100000 10000010 // dot2
-// 11100010 10100000 10000100 // dot3
-// 11100010 10100001 10000000 // dot0-1
-// 11100010 10100000 10001000 // dot4
-// 11100010 10100000 10010000 // dot5
-// 11100010 10100000 10100000 // dot6
-// 11100010 10100010 10000000 // dot0-2
+constexpr uint32_t g_braille_empty = 0x2800;  // "⠀"
 
 // NOLINTNEXTLINE
-uint8_t g_map_braille[2][4][2] = {
+uint8_t g_map_braille[2][4] = {
     {
-        {0b00000000, 0b00000001},  // NOLINT | dot1
-        {0b00000000, 0b00000010},  // NOLINT | dot2
-        {0b00000000, 0b00000100},  // NOLINT | dot3
-        {0b00000001, 0b00000000},  // NOLINT | dot0-1
+        0b0000'0001,  // NOLINT | dot1
+        0b0000'0010,  // NOLINT | dot2
+        0b0000'0100,  // NOLINT | dot3
+        0b0100'0000,  // NOLINT | dot0-1
     },
     {
-        {0b00000000, 0b00001000},  // NOLINT | dot4
-        {0b00000000, 0b00010000},  // NOLINT | dot5
-        {0b00000000, 0b00100000},  // NOLINT | dot6
-        {0b00000010, 0b00000000},  // NOLINT | dot0-2
+        0b0000'1000,  // NOLINT | dot4
+        0b0001'0000,  // NOLINT | dot5
+        0b0010'0000,  // NOLINT | dot6
+        0b1000'0000,  // NOLINT | dot0-2
     },
 };
 
@@ -134,12 +126,13 @@ void Canvas::DrawPointOn(int x, int y) {
   }
   Cell& cell = storage_[XY{x / 2, y / 4}];
   if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 bytes.
+    cell.content.character = Glyph::FromCodepoint(g_braille_empty);
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  const uint32_t codepoint = cell.content.character.codepoint();
+  cell.content.character = Glyph::FromCodepoint(  //
+      codepoint | g_map_braille[x % 2][y % 4]);    // NOLINT
 }
 
 /// @brief Erase a braille dot.
@@ -151,12 +144,13 @@ void Canvas::DrawPointOff(int x, int y) {
   }
   Cell& cell = storage_[XY{x / 2, y / 4}];
   if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 byt
+    cell.content.character = Glyph::FromCodepoint(g_braille_empty);
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
-  cell.content.character[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  const uint32_t codepoint = cell.content.character.codepoint();
+  cell.content.character = Glyph::FromCodepoint(              //
+      codepoint & ~uint32_t(g_map_braille[x % 2][y % 4]));  // NOLINT
 }
 
 /// @brief Toggle a braille dot. A filled one will be erased, and the other will
@@ -169,12 +163,13 @@ void Canvas::DrawPointToggle(int x, int y) {
   }
   Cell& cell = storage_[XY{x / 2, y / 4}];
   if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 byt
+    cell.content.character = Glyph::FromCodepoint(g_braille_empty);
     cell.type = CellType::kBraille;
   }
 
-  cell.content.character[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  const uint32_t codepoint = cell.content.character.codepoint();
+  cell.content.character = Glyph::FromCodepoint(  //
+      codepoint ^ g_map_braille[x % 2][y % 4]);    // NOLINT
 }
 
 /// @brief Draw a line made of braille dots.
@@ -832,11 +827,20 @@ class CanvasNodeBase : public Node {
     const Canvas& c = canvas();
     const int y_max = std::min(c.height() / 4, box_.y_max - box_.y_min + 1);
     const int x_max = std::min(c.width() / 2, box_.x_max - box_.x_min + 1);
+    bool automerge = false;
     for (int y = 0; y < y_max; ++y) {
       for (int x = 0; x < x_max; ++x) {
-        screen.PixelAt(box_.x_min + x, box_.y_min + y) = c.GetPixel(x, y);
+        const Pixel& pixel = c.GetPixel(x, y);
+        screen.PixelAtRegistered(box_.x_min + x, box_.y_min + y) = pixel;
+        automerge |= pixel.automerge;
       }
     }
+
+    // A style may have set Pixel::automerge.
+    if (automerge) {
+      screen.RegisterAutomerge({box_.x_min, box_.x_min + x_max - 1,  //
+                                box_.y_min, box_.y_min + y_max - 1});
+    }
   }
 
   virtual const Canvas& canvas() = 0;
@@ -855,7 +859,7 @@ Element canvas(ConstRef<Canvas> canvas) {
     const Canvas& canvas() final { return *canvas_; }
     ConstRef<Canvas> canvas_;
   };
-  return std::make_shared<Impl>(std::move(canvas));
+  return MakeNode<Impl>(std::move(canvas));
 }
 
 /// @brief Produce an element drawing a canvas of requested size.
@@ -887,7 +891,7 @@ Element canvas(int width, int height, std::function<void(Canvas&)> fn) {
     int height_;
     std::function<void(Canvas&)> fn_;
   };
-  return std::make_shared<Impl>(width, height, std::move(fn));
+  return MakeNode<Impl>(width, height, std::move(fn));
 }
 
 /// @brief Produce an element drawing a canvas.
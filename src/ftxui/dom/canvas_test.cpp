@@ -53,7 +53,7 @@ TEST(CanvasTest, GoldPointColor) {
   });
   Screen screen(30, 10);
   Render(screen, element);
-  EXPECT_EQ(Hash(screen.ToString()), 1264423298);
+  EXPECT_EQ(Hash(screen.ToString()), 4112518716);
 }
 
 TEST(CanvasTest, GoldBlock) {
@@ -86,7 +86,7 @@ TEST(CanvasTest, GoldBlockColor) {
   });
   Screen screen(30, 10);
   Render(screen, element);
-  EXPECT_EQ(Hash(screen.ToString()), 3048712696);
+  EXPECT_EQ(Hash(screen.ToString()), 841645876);
 }
 
 TEST(CanvasTest, GoldText) {
@@ -101,6 +101,22 @@ TEST(CanvasTest, GoldText) {
   EXPECT_EQ(Hash(screen.ToString()), 1074960375);
 }
 
+// A style setting Pixel::automerge merges the box characters of the canvas.
+TEST(CanvasTest, Automerge) {
+  const auto automerge = [](Pixel& pixel) { pixel.automerge = true; };
+  Canvas c(6, 12);
+  c.DrawText(0, 4, "───", automerge);
+  c.DrawText(2, 0, "│", automerge);
+  c.DrawText(2, 8, "│", automerge);
+  auto element = canvas(c);
+  Screen screen(3, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            " │ \r\n"
+            "─┼─\r\n"
+            " │ ");
+}
+
 }  // namespace ftxui
 // NOLINTEND
 
@@ -1,6 +1,7 @@
-#include <memory>   // for make_shared
+#include <memory>   // for shared_ptr
 #include <utility>  // for move
 
+#include "ftxui/dom/arena.hpp"           // for MakeNode
 #include "ftxui/dom/elements.hpp"        // for Element, clear_under
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
@@ -16,9 +17,10 @@ class ClearUnder : public NodeDecorator {
   using NodeDecorator::NodeDecorator;
 
   void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y) = Pixel();
+    const Box box = Box::Intersection(box_, screen.stencil);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        screen.PixelAtRegistered(x, y) = Pixel();
       }
     }
     Node::Render(screen);
@@ -30,7 +32,7 @@ class ClearUnder : public NodeDecorator {
 /// @see ftxui::dbox
 /// @ingroup dom
 Element clear_under(Element element) {
-  return std::make_shared<ClearUnder>(std::move(element));
+  return MakeNode<ClearUnder>(std::move(element));
 }
 
 }  // namespace ftxui
@@ -1,8 +1,9 @@
 #include <algorithm>  // for max
-#include <memory>     // for __shared_ptr_access, shared_ptr, make_shared
+#include <memory>     // for __shared_ptr_access, shared_ptr
 #include <utility>    // for move
 #include <vector>     // for vector
 
+#include "ftxui/dom/arena.hpp"        // for MakeNode
 #include "ftxui/dom/elements.hpp"     // for Element, Elements, dbox
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
@@ -23,6 +24,7 @@ class DBox : public Node {
     requirement_.flex_shrink_y = 0;
     requirement_.selection = Requirement::NORMAL;
     for (auto& child : children_) {
+      child->SetAvailableWidth(available_width_);
       child->ComputeRequirement();
       requirement_.min_x =
           std::max(requirement_.min_x, child->requirement().min_x);
@@ -50,7 +52,7 @@ class DBox : public Node {
 /// @return The right aligned element.
 /// @ingroup dom
 Element dbox(Elements children_) {
-  return std::make_shared<DBox>(std::move(children_));
+  return MakeNode<DBox>(std::move(children_));
 }
 
 }  // namespace ftxui
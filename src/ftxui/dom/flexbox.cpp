@@ -1,9 +1,10 @@
 #include <algorithm>  // for min, max
 #include <cstddef>    // for size_t
-#include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type, make_shared
+#include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type
 #include <utility>  // for move, swap
 #include <vector>   // for vector
 
+#include "ftxui/dom/arena.hpp"     // for MakeNode
 #include "ftxui/dom/elements.hpp"  // for Element, Elements, flexbox, hflow, vflow
 #include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::Direction::Column, FlexboxConfig::AlignContent, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::JustifyContent, FlexboxConfig::Wrap, FlexboxConfig::AlignContent::FlexStart, FlexboxConfig::Direction::RowInversed, FlexboxConfig::JustifyContent::FlexStart, FlexboxConfig::Wrap::Wrap
 #include "ftxui/dom/flexbox_helper.hpp"  // for Block, Global, Compute
@@ -86,8 +87,15 @@ class Flexbox : public Node {
 
   void ComputeRequirement() override {
     for (auto& child : children_) {
+      child->SetAvailableWidth(available_width_);
       child->ComputeRequirement();
     }
+    // Wrap at the available width from the start. When it is the one given by
+    // SetBox(), no other iteration is needed.
+    if (!IsColumnOriented()) {
+      asked_ = std::min(asked_, std::max(0, available_width_));
+    }
+
     flexbox_helper::Global global;
     global.config = config_normalized_;
     if (IsColumnOriented()) {
@@ -215,7 +223,7 @@ class Flexbox : public Node {
 //  )
 /// ```
 Element flexbox(Elements children, FlexboxConfig config) {
-  return std::make_shared<Flexbox>(std::move(children), config);
+  return MakeNode<Flexbox>(std::move(children), config);
 }
 
 /// @brief A container displaying elements in rows from left to right. When
@@ -87,7 +87,7 @@ struct Line {
 
 void SetX(Global& global, std::vector<Line> lines) {
   for (auto& line : lines) {
-    std::vector<box_helper::Element> elements;
+    box_helper::Elements elements;
     for (auto* block : line.blocks) {
       box_helper::Element element;
       element.min_size = block->min_size_x;
@@ -116,7 +116,7 @@ void SetX(Global& global, std::vector<Line> lines) {
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 void SetY(Global& g, std::vector<Line> lines) {
-  std::vector<box_helper::Element> elements;
+  box_helper::Elements elements;
   for (auto& line : lines) {
     box_helper::Element element;
     element.flex_shrink = line.blocks.front()->flex_shrink_y;
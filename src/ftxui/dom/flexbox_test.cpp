@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
+#include <memory>  // for make_shared
 #include <string>  // for allocator
 
-#include "ftxui/dom/elements.hpp"        // for text, flexbox
+#include "ftxui/dom/elements.hpp"        // for text, flexbox, hflow, hbox, vbox, border
 #include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::AlignContent, FlexboxConfig::JustifyContent, FlexboxConfig::Direction::Column, FlexboxConfig::AlignItems, FlexboxConfig::JustifyContent::SpaceAround, FlexboxConfig::AlignContent::Center, FlexboxConfig::AlignContent::FlexEnd, FlexboxConfig::AlignContent::SpaceAround, FlexboxConfig::AlignContent::SpaceBetween, FlexboxConfig::AlignContent::SpaceEvenly, FlexboxConfig::AlignItems::Center, FlexboxConfig::AlignItems::FlexEnd, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::Direction::RowInversed, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::SpaceBetween
+#include "ftxui/dom/iteration_counter_test.hpp"  // for IterationCounter
 #include "ftxui/dom/node.hpp"            // for Render
 #include "ftxui/screen/screen.hpp"       // for Screen
 
@@ -454,6 +456,56 @@ TEST(FlexboxTest, Focus) {
             "-");
 }
 
+TEST(FlexboxTest, SingleIteration) {
+  int iterations = 0;
+  auto root = std::make_shared<IterationCounter>(
+      vbox({
+          hflow({text("aaa"), text("bbb"), text("ccc")}),
+          hflow({text("ddd"), text("eee"), text("fff")}) | border,
+      }),
+      &iterations);
+
+  Screen screen(8, 6);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "aaabbb  \r\n"
+            "ccc     \r\n"
+            "╭──────╮\r\n"
+            "│dddeee│\r\n"
+            "│fff   │\r\n"
+            "╰──────╯");
+  EXPECT_EQ(iterations, 1);
+}
+
+TEST(FlexboxTest, NarrowerThanAvailable) {
+  // The width available is only an upper bound. The layout still resolves
+  // when the box given is narrower.
+  auto root = hbox({
+      text("xx"),
+      hflow({text("aaa"), text("bbb"), text("ccc")}),
+  });
+
+  Screen screen(8, 3);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "xxaaabbb\r\n"
+            "  ccc   \r\n"
+            "        ");
+}
+
+TEST(FlexboxTest, NarrowerThanBorder) {
+  // The border takes more than the available width. Its content gets none,
+  // not a negative width.
+  auto root = hflow({text("aaa"), text("bbb")}) | border;
+
+  Screen screen(1, 3);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            " \r\n"
+            " \r\n"
+            " ");
+}
+
 }  // namespace ftxui
 // NOLINTEND
 
@@ -1,6 +1,7 @@
-#include <memory>   // for make_shared
+#include <memory>   // for shared_ptr
 #include <utility>  // for move
 
+#include "ftxui/dom/arena.hpp"     // for MakeNode
 #include "ftxui/dom/elements.hpp"  // for Decorator, Element, focusPosition, focusPositionRelative
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::NORMAL, Requirement::Selection
@@ -48,7 +49,7 @@ Decorator focusPositionRelative(float x, float y) {
   };
 
   return [x, y](Element child) {
-    return std::make_shared<Impl>(std::move(child), x, y);
+    return MakeNode<Impl>(std::move(child), x, y);
   };
 }
 
@@ -87,7 +88,7 @@ Decorator focusPosition(int x, int y) {
   };
 
   return [x, y](Element child) {
-    return std::make_shared<Impl>(std::move(child), x, y);
+    return MakeNode<Impl>(std::move(child), x, y);
   };
 }
 
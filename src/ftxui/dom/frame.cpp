@@ -1,9 +1,11 @@
 #include <algorithm>  // for max, min
-#include <memory>     // for make_shared, __shared_ptr_access
+#include <limits>     // for numeric_limits
+#include <memory>     // for __shared_ptr_access
 #include <utility>    // for move
 #include <vector>     // for __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, Elements, focus, frame, select, xframe, yframe
+#include "ftxui/dom/arena.hpp"     // for MakeNode
+#include "ftxui/dom/elements.hpp"  // for Element, Elements, focus, frame, select, xframe, yframe
 #include "ftxui/dom/node.hpp"  // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::FOCUSED, Requirement::SELECTED
 #include "ftxui/screen/box.hpp"      // for Box
@@ -16,7 +18,7 @@ namespace ftxui {
 
 class Select : public Node {
  public:
-  explicit Select(Elements children) : Node(std::move(children)) {}
+  explicit Select(Element child) : Node(std::move(child)) {}
 
   void ComputeRequirement() override {
     Node::ComputeRequirement();
@@ -36,7 +38,7 @@ class Select : public Node {
 };
 
 Element select(Element child) {
-  return std::make_shared<Select>(unpack(std::move(child)));
+  return MakeNode<Select>(std::move(child));
 }
 
 // -----------------------------------------------------------------------------
@@ -81,18 +83,21 @@ class Focus : public Select {
 };
 
 Element focus(Element child) {
-  return std::make_shared<Focus>(unpack(std::move(child)));
+  return MakeNode<Focus>(std::move(child));
 }
 
 // -----------------------------------------------------------------------------
 
 class Frame : public Node {
  public:
-  Frame(Elements children, bool x_frame, bool y_frame)
-      : Node(std::move(children)), x_frame_(x_frame), y_frame_(y_frame) {}
+  Frame(Element child, bool x_frame, bool y_frame)
+      : Node(std::move(child)), x_frame_(x_frame), y_frame_(y_frame) {}
 
   void ComputeRequirement() override {
-    Node::ComputeRequirement();
+    // The internal area can be wider than the frame.
+    children_[0]->SetAvailableWidth(
+        x_frame_ ? std::numeric_limits<int>::max() : available_width_);
+    children_[0]->ComputeRequirement();
     requirement_ = children_[0]->requirement();
   }
 
@@ -140,21 +145,21 @@ class Frame : public Node {
 /// displayed. The view is scrollable to make the focused element visible.
 /// @see focus
 Element frame(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, true);
+  return MakeNode<Frame>(std::move(child), true, true);
 }
 
 Element xframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, false);
+  return MakeNode<Frame>(std::move(child), true, false);
 }
 
 Element yframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), false, true);
+  return MakeNode<Frame>(std::move(child), false, true);
 }
 
 class FocusCursor : public Focus {
  public:
-  FocusCursor(Elements children, Screen::Cursor::Shape shape)
-      : Focus(std::move(children)), shape_(shape) {}
+  FocusCursor(Element child, Screen::Cursor::Shape shape)
+      : Focus(std::move(child)), shape_(shape) {}
 
  private:
   void Render(Screen& screen) override {
@@ -169,28 +174,26 @@ class FocusCursor : public Focus {
 };
 
 Element focusCursorBlock(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
-                                       Screen::Cursor::Block);
+  return MakeNode<FocusCursor>(std::move(child), Screen::Cursor::Block);
 }
 Element focusCursorBlockBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
-                                       Screen::Cursor::BlockBlinking);
+  return MakeNode<FocusCursor>(std::move(child),
+                               Screen::Cursor::BlockBlinking);
 }
 Element focusCursorBar(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
-                                       Screen::Cursor::Bar);
+  return MakeNode<FocusCursor>(std::move(child), Screen::Cursor::Bar);
 }
 Element focusCursorBarBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
-                                       Screen::Cursor::BarBlinking);
+  return MakeNode<FocusCursor>(std::move(child),
+                               Screen::Cursor::BarBlinking);
 }
 Element focusCursorUnderline(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
-                                       Screen::Cursor::Underline);
+  return MakeNode<FocusCursor>(std::move(child),
+                               Screen::Cursor::Underline);
 }
 Element focusCursorUnderlineBlinking(Element child) {
-  return std::make_shared<FocusCursor>(unpack(std::move(child)),
-                                       Screen::Cursor::UnderlineBlinking);
+  return MakeNode<FocusCursor>(std::move(child),
+                               Screen::Cursor::UnderlineBlinking);
 }
 
 }  // namespace ftxui
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <memory>  // for make_shared
+#include <string>  // for to_string
+
+#include "ftxui/dom/elements.hpp"  // for text, vbox, hbox, frame, yframe, flex, xflex, filler, focus, reflect, bgcolor, operator|, Element, Elements
+#include "ftxui/dom/node.hpp"       // for Node, Render
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// A line counting how many times it is rendered.
+class Counter : public Node {
+ public:
+  explicit Counter(int* count) : count_(count) {}
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+  void Render(Screen&) override { (*count_)++; }
+
+ private:
+  int* count_;
+};
+
+}  // namespace
+
+TEST(FrameTest, Basic) {
+  Elements lines;
+  for (int i = 0; i < 10; ++i) {
+    lines.push_back(text(std::to_string(i)));
+  }
+  lines[5] |= focus;
+  auto root = vbox(std::move(lines)) | frame;
+
+  Screen screen(1, 3);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "4\r\n"
+            "5\r\n"
+            "6");
+}
+
+TEST(FrameTest, OffscreenChildrenAreNotRendered) {
+  int count = 0;
+  Elements lines;
+  for (int i = 0; i < 1000; ++i) {
+    lines.push_back(std::make_shared<Counter>(&count));
+  }
+  auto root = vbox(std::move(lines)) | frame;
+
+  Screen screen(1, 3);
+  Render(screen, root);
+  EXPECT_EQ(count, 3);
+}
+
+TEST(FrameTest, OffscreenColumnsAreNotRendered) {
+  int count = 0;
+  Elements columns;
+  for (int i = 0; i < 1000; ++i) {
+    columns.push_back(std::make_shared<Counter>(&count));
+  }
+  columns[500] |= focus;
+  auto root = hbox(std::move(columns)) | frame;
+
+  Screen screen(4, 1);
+  Render(screen, root);
+  EXPECT_EQ(count, 4);
+}
+
+TEST(FrameTest, OffscreenReflectIsEmpty) {
+  Box visible;
+  Box hidden;
+  auto root = vbox({
+                  text("a") | reflect(visible),
+                  text("b"),
+                  text("c") | reflect(hidden),
+              }) |
+              frame;
+
+  Screen screen(1, 2);
+  Render(screen, root);
+  EXPECT_EQ(visible, (Box{0, 0, 0, 0}));
+  EXPECT_FALSE(hidden.Contain(0, 2));
+  EXPECT_FALSE(hidden.Contain(0, 1));
+}
+
+TEST(FrameTest, DecoratorClippedToStencil) {
+  auto root = vbox({
+      vbox({
+          text("a"),
+          text("b"),
+          text("c"),
+      }) | bgcolor(Color::Red) |
+          frame | size(HEIGHT, EQUAL, 2),
+      text("d"),
+  });
+
+  Screen screen(1, 3);
+  Render(screen, root);
+  EXPECT_EQ(screen.PixelAt(0, 2).character, "d");
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Color::Red);
+  EXPECT_EQ(screen.PixelAt(0, 1).background_color, Color::Red);
+  EXPECT_EQ(screen.PixelAt(0, 2).background_color, Color());
+}
+
+// The flex decorators are laid out, and rendered, inside of an offset frame.
+TEST(FrameTest, FlexChildrenInOffsetFrame) {
+  auto element = vbox({
+      text("header"),
+      vbox({
+          text("flexed") | flex,
+          text("plain"),
+      }) | frame,
+  });
+  Screen screen(6, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "header\r\n"
+            "flexed\r\n"
+            "      ");
+}
+
+TEST(FrameTest, XflexChildrenInOffsetYframe) {
+  auto element = vbox({
+      text("header"),
+      hbox({
+          text("L"),
+          filler(),
+          text("R") | xflex,
+      }) | yframe,
+  });
+  Screen screen(6, 2);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "header\r\n"
+            "L  R  ");
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
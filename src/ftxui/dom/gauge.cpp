@@ -1,7 +1,8 @@
 #include <ftxui/dom/direction.hpp>  // for Direction, Direction::Down, Direction::Left, Direction::Right, Direction::Up
-#include <memory>                   // for allocator, make_shared
+#include <memory>                   // for allocator
 #include <string>                   // for string
 
+#include "ftxui/dom/arena.hpp"     // for MakeNode
 #include "ftxui/dom/elements.hpp"  // for Element, gauge, gaugeDirection, gaugeDown, gaugeLeft, gaugeRight, gaugeUp
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
@@ -115,7 +116,7 @@ class Gauge : public Node {
 
     if (invert) {
       for (int x = box_.x_min; x <= box_.x_max; x++) {
-        screen.PixelAt(x, y).inverted ^= true;
+        screen.PixelAtRegistered(x, y).inverted ^= true;
       }
     }
   }
@@ -145,7 +146,7 @@ class Gauge : public Node {
 
     if (invert) {
       for (int y = box_.y_min; y <= box_.y_max; y++) {
-        screen.PixelAt(x, y).inverted ^= true;
+        screen.PixelAtRegistered(x, y).inverted ^= true;
       }
     }
   }
@@ -161,7 +162,7 @@ class Gauge : public Node {
 //  @param direction Direction of progress bars progression.
 /// @ingroup dom
 Element gaugeDirection(float progress, Direction direction) {
-  return std::make_shared<Gauge>(progress, direction);
+  return MakeNode<Gauge>(progress, direction);
 }
 
 /// @brief Draw a high definition progress bar progressing from left to right.
@@ -1,9 +1,10 @@
 #include <functional>  // for function
-#include <memory>      // for allocator, make_shared
+#include <memory>      // for allocator
 #include <string>      // for string
 #include <utility>     // for move
 #include <vector>      // for vector
 
+#include "ftxui/dom/arena.hpp"        // for MakeNode
 #include "ftxui/dom/elements.hpp"     // for GraphFunction, Element, graph
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
@@ -60,7 +61,7 @@ class Graph : public Node {
 /// @brief Draw a graph using a GraphFunction.
 /// @param graph_function the function to be called to get the data.
 Element graph(GraphFunction graph_function) {
-  return std::make_shared<Graph>(std::move(graph_function));
+  return MakeNode<Graph>(std::move(graph_function));
 }
 
 }  // namespace ftxui
@@ -1,9 +1,10 @@
 #include <algorithm>  // for max, min
 #include <cstddef>    // for size_t
-#include <memory>  // for __shared_ptr_access, shared_ptr, make_shared, allocator_traits<>::value_type
+#include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
+#include "ftxui/dom/arena.hpp"        // for MakeNode
 #include "ftxui/dom/box_helper.hpp"   // for Element, Compute
 #include "ftxui/dom/elements.hpp"     // for Elements, filler, Element, gridbox
 #include "ftxui/dom/node.hpp"         // for Node
@@ -54,6 +55,7 @@ class GridBox : public Node {
 
     for (auto& line : lines_) {
       for (auto& cell : line) {
+        cell->SetAvailableWidth(available_width_);
         cell->ComputeRequirement();
       }
     }
@@ -95,8 +97,8 @@ class GridBox : public Node {
     init.min_size = 0;
     init.flex_grow = 1024;    // NOLINT
     init.flex_shrink = 1024;  // NOLINT
-    std::vector<box_helper::Element> elements_x(x_size, init);
-    std::vector<box_helper::Element> elements_y(y_size, init);
+    box_helper::Elements elements_x(x_size, init);
+    box_helper::Elements elements_y(y_size, init);
 
     for (int y = 0; y < y_size; ++y) {
       for (int x = 0; x < x_size; ++x) {
@@ -176,7 +178,7 @@ class GridBox : public Node {
 /// ╰──────────╯╰──────╯╰──────────╯
 /// ```
 Element gridbox(std::vector<Elements> lines) {
-  return std::make_shared<GridBox>(std::move(lines));
+  return MakeNode<GridBox>(std::move(lines));
 }
 
 }  // namespace ftxui
@@ -0,0 +1,44 @@
+#ifndef FTXUI_DOM_ITERATION_COUNTER_TEST_HPP
+#define FTXUI_DOM_ITERATION_COUNTER_TEST_HPP
+
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"  // for Element
+#include "ftxui/dom/node.hpp"      // for Node, Node::Status
+#include "ftxui/screen/box.hpp"    // for Box
+
+namespace ftxui {
+
+// Record the number of layout iterations of the tree it is the root of. Used
+// by the tests and the benchmarks only.
+class IterationCounter : public Node {
+ public:
+  IterationCounter(Element child, int* iterations)
+      : Node({std::move(child)}), iterations_(iterations) {}
+
+  void ComputeRequirement() override {
+    Node::ComputeRequirement();
+    requirement_ = children_[0]->requirement();
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    children_[0]->SetBox(box);
+  }
+
+  void Check(Status* status) override {
+    Node::Check(status);
+    *iterations_ = status->iteration;
+  }
+
+ private:
+  int* iterations_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_ITERATION_COUNTER_TEST_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,41 @@
+#ifndef FTXUI_DOM_LAYOUT_HPP
+#define FTXUI_DOM_LAYOUT_HPP
+
+#include "ftxui/dom/node.hpp"         // for Node, Node::Status
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+
+namespace ftxui {
+
+// Compute the layout of |node|, given |available_width| columns:
+// 1. Find what dimension the element wants to be: ComputeRequirement().
+// 2. Assign it a dimension: SetBox(get_box(requirement)).
+// Repeat, as long as an element asks for another iteration.
+template <typename GetBox>
+void Layout(Node* node, int available_width, GetBox get_box) {
+  Node::Status status;
+  node->Check(&status);
+  node->SetAvailableWidth(available_width);
+  const int max_iterations = 20;
+  while (status.need_iteration && status.iteration < max_iterations) {
+    node->ComputeRequirement();
+    node->SetBox(get_box(node->requirement()));
+    status.need_iteration = false;
+    status.iteration++;
+    node->Check(&status);
+  }
+}
+
+// Same as above, for a fixed |box|.
+inline void Layout(Node* node, const Box& box) {
+  Layout(node, box.x_max - box.x_min + 1,
+         [&box](const Requirement& /*requirement*/) { return box; });
+}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_LAYOUT_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,19 +1,28 @@
+#include <algorithm>             // for max
 #include <ftxui/screen/box.hpp>  // for Box
+#include <iterator>              // for make_move_iterator
 #include <utility>               // for move
 
+#include "ftxui/dom/layout.hpp"  // for Layout
 #include "ftxui/dom/node.hpp"
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 namespace ftxui {
 
 Node::Node() = default;
-Node::Node(Elements children) : children_(std::move(children)) {}
+Node::Node(Elements children)
+    : children_(std::make_move_iterator(children.begin()),
+                std::make_move_iterator(children.end())) {}
+Node::Node(Element child) {
+  children_.push_back(std::move(child));
+}
 Node::~Node() = default;
 
 /// @brief Compute how much space an elements needs.
 /// @ingroup dom
 void Node::ComputeRequirement() {
   for (auto& child : children_) {
+    child->SetAvailableWidth(available_width_);
     child->ComputeRequirement();
   }
 }
@@ -25,13 +34,29 @@ void Node::SetBox(Box box) {
 }
 
 /// @brief Display an element on a ftxui::Screen.
+/// The children lying outside of the stencil are not visible, so they are
+/// skipped. This makes the cost proportional to what is displayed.
 /// @ingroup dom
 void Node::Render(Screen& screen) {
   for (auto& child : children_) {
-    child->Render(screen);
+    if (child->IsVisible(screen)) {
+      child->Render(screen);
+    }
   }
 }
 
+/// @brief Return whether the box of this element intersects the stencil.
+/// An empty box is still considered visible when it is located inside the
+/// stencil, since it can carry the cursor.
+/// @ingroup dom
+bool Node::IsVisible(const Screen& screen) const {
+  const Box& stencil = screen.stencil;
+  return std::max(box_.x_min, box_.x_max) >= stencil.x_min &&
+         box_.x_min <= stencil.x_max &&
+         std::max(box_.y_min, box_.y_max) >= stencil.y_min &&
+         box_.y_min <= stencil.y_max;
+}
+
 void Node::Check(Status* status) {
   for (auto& child : children_) {
     child->Check(status);
@@ -54,21 +79,9 @@ void Render(Screen& screen, Node* node) {
   box.x_max = screen.dimx() - 1;
   box.y_max = screen.dimy() - 1;
 
-  Node::Status status;
-  node->Check(&status);
-  const int max_iterations = 20;
-  while (status.need_iteration && status.iteration < max_iterations) {
-    // Step 1: Find what dimension this elements wants to be.
-    node->ComputeRequirement();
-
-    // Step 2: Assign a dimension to the element.
-    node->SetBox(box);
-
-    // Check if the element needs another iteration of the layout algorithm.
-    status.need_iteration = false;
-    status.iteration++;
-    node->Check(&status);
-  }
+  // Step 1 and 2: Find what dimension this elements wants to be, and assign
+  // it a dimension.
+  Layout(node, box);
 
   // Step 3: Draw the element.
   screen.stencil = box;
@@ -3,7 +3,7 @@
 
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack
+#include "ftxui/dom/elements.hpp"  // for Element
 #include "ftxui/dom/node.hpp"      // for Node
 
 namespace ftxui {
@@ -12,7 +12,7 @@ struct Box;
 // Helper class.
 class NodeDecorator : public Node {
  public:
-  NodeDecorator(Element child) : Node(unpack(std::move(child))) {}
+  NodeDecorator(Element child) : Node(std::move(child)) {}
   void ComputeRequirement() override;
   void SetBox(Box box) override;
 };
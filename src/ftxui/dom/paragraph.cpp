@@ -1,71 +1,302 @@
-#include <sstream>  // for basic_istream, stringstream
-#include <string>   // for string, allocator, getline
-#include <utility>  // for move
+#include <algorithm>      // for min, max
+#include <cstddef>        // for size_t
+#include <limits>         // for numeric_limits
+#include <list>           // for list
+#include <memory>         // for shared_ptr, make_shared
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move, pair
+#include <vector>         // for vector
 
-#include "ftxui/dom/elements.hpp"  // for flexbox, Element, text, Elements, operator|, xflex, paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight
-#include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::JustifyContent, FlexboxConfig::JustifyContent::Center, FlexboxConfig::JustifyContent::FlexEnd, FlexboxConfig::JustifyContent::SpaceBetween
+#include "ftxui/dom/arena.hpp"     // for MakeNode
+#include "ftxui/dom/elements.hpp"  // for Element, paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight
+#include "ftxui/dom/node.hpp"      // for Node, Node::Status
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/glyph.hpp"     // for Glyph
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/string.hpp"    // for Utf8ToGlyphs
 
 namespace ftxui {
 
 namespace {
-Elements Split(const std::string& the_text) {
-  Elements output;
-  std::stringstream ss(the_text);
-  std::string word;
-  while (std::getline(ss, word, ' ')) {
-    output.push_back(text(word));
+
+enum class Alignment { Left, Right, Center, Justify };
+
+// The text of a paragraph, split into cells and words. It is shared by the
+// paragraphs with the same text, and kept from one frame to the next.
+class Words {
+ public:
+  explicit Words(const std::string& text) {
+    for (const auto& cell : Utf8ToGlyphs(text)) {
+      cells_.emplace_back(cell);
+    }
+
+    // The words are separated by a single space, like with a flexbox of words
+    // with a gap of 1. Consecutive spaces make empty words.
+    int begin = 0;
+    for (int i = 0; i < int(cells_.size()); ++i) {
+      if (cells_[i] == " ") {
+        words_.push_back({begin, i});
+        begin = i + 1;
+      }
+    }
+    words_.push_back({begin, int(cells_.size())});
+  }
+
+  struct Word {
+    int begin;  // Index of the first cell.
+    int end;    // Index past the last cell.
+    int width() const { return end - begin; }
+  };
+  const std::vector<Glyph>& cells() const { return cells_; }
+  const std::vector<Word>& words() const { return words_; }
+
+  // The memory used by the cells and the words.
+  size_t bytes() const {
+    return cells_.size() * sizeof(Glyph) + words_.size() * sizeof(Word);
   }
-  return output;
+
+  // The index of the first word of every line, when wrapped at |width|.
+  using Lines = std::shared_ptr<const std::vector<int>>;
+  Lines Wrap(int width) {
+    for (const auto& it : lines_) {
+      if (it.first == width) {
+        return it.second;
+      }
+    }
+
+    auto lines = std::make_shared<std::vector<int>>();
+    int x = 0;
+    for (int i = 0; i < int(words_.size()); ++i) {
+      const int word_width = words_[i].width();
+      if (lines->empty()) {
+        lines->push_back(i);
+      } else if (x + word_width > width) {
+        lines->push_back(i);
+        x = 0;
+      }
+      x += word_width + 1;
+    }
+
+    // Only the latest widths are remembered.
+    const size_t max_widths = 4;
+    if (lines_.size() == max_widths) {
+      lines_.erase(lines_.begin());
+    }
+    lines_.emplace_back(width, lines);
+    return lines;
+  }
+
+ private:
+  std::vector<Glyph> cells_;
+  std::vector<Word> words_;
+  std::vector<std::pair<int, Lines>> lines_;
+};
+
+// The words of the recent paragraphs, indexed by their text. The least
+// recently used are evicted, once they take more than |kMaxBytes|.
+class WordsCache {
+ public:
+  std::shared_ptr<Words> Get(const std::string& text) {
+    auto it = index_.find(text);
+    if (it != index_.end()) {
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return it->second->words;
+    }
+
+    auto words = std::make_shared<Words>(text);
+    entries_.push_front({text, words, text.size() + words->bytes()});
+    index_.emplace(entries_.front().text, entries_.begin());
+    bytes_ += entries_.front().bytes;
+
+    // Keep at least the new entry, even when it is larger than the budget.
+    while (bytes_ > kMaxBytes && entries_.size() > 1) {
+      bytes_ -= entries_.back().bytes;
+      index_.erase(entries_.back().text);
+      entries_.pop_back();
+    }
+    return words;
+  }
+
+ private:
+  static constexpr size_t kMaxBytes = 1 << 22;  // 4 MiB.
+
+  struct Entry {
+    std::string text;
+    std::shared_ptr<Words> words;
+    size_t bytes;
+  };
+  // From the most to the least recently used.
+  std::list<Entry> entries_;
+  std::unordered_map<std::string_view, std::list<Entry>::iterator> index_;
+  size_t bytes_ = 0;
+};
+
+std::shared_ptr<Words> GetWords(const std::string& text) {
+  thread_local WordsCache cache;
+  return cache.Get(text);
 }
+
+class Paragraph : public Node {
+ public:
+  Paragraph(std::shared_ptr<Words> words, Alignment alignment)
+      : words_(std::move(words)), alignment_(alignment) {}
+
+  void ComputeRequirement() override {
+    asked_ = std::min(asked_, available_width_);
+    lines_ = words_->Wrap(asked_);
+
+    requirement_ = Requirement();
+    requirement_.flex_grow_x = 1;
+    requirement_.min_y = int(lines_->size());
+    for (size_t i = 0; i < lines_->size(); ++i) {
+      requirement_.min_x = std::max(requirement_.min_x, LineWidth(i));
+    }
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    const int asked_previous = asked_;
+    asked_ = std::min(asked_, box.x_max - box.x_min + 1);
+    need_iteration_ = (asked_ != asked_previous);
+  }
+
+  void Check(Status* status) override {
+    if (status->iteration == 0) {
+      asked_ = std::numeric_limits<int>::max();
+      need_iteration_ = false;
+    }
+    Node::Check(status);
+    status->need_iteration |= need_iteration_;
+  }
+
+  void Render(Screen& screen) override {
+    const Box box = Box::Intersection(box_, screen.stencil);
+    const int width = box_.x_max - box_.x_min + 1;
+    const auto& words = words_->words();
+    const auto& lines = *lines_;
+    const int first_line = std::max(0, box.y_min - box_.y_min);
+    const int last_line = std::min(int(lines.size()) - 1,  //
+                                   box.y_max - box_.y_min);
+    for (int i = first_line; i <= last_line; ++i) {
+      const int y = box_.y_min + i;
+      const int begin = lines[i];
+      const int end = LineEnd(i);
+      const int remaining = std::max(0, width - LineWidth(i));
+
+      // Justified lines distribute the remaining space between their words,
+      // from the last one, like JustifyContent::SpaceBetween. The last line
+      // is aligned on the left.
+      if (alignment_ == Alignment::Justify && i != int(lines.size()) - 1) {
+        int space = remaining;
+        for (int w = end - 1; w > begin; --w) {
+          const int index = w - begin;
+          const int x = box_.x_min + words[w].begin - words[begin].begin;
+          DrawWord(screen, box, words[w], x + space, y);
+          space = space * (index - 1) / index;
+        }
+        DrawWord(screen, box, words[begin], box_.x_min, y);
+        continue;
+      }
+
+      int x = box_.x_min;
+      if (alignment_ == Alignment::Right) {
+        x += remaining;
+      }
+      if (alignment_ == Alignment::Center) {
+        x += remaining / 2;
+      }
+      for (int w = begin; w < end; ++w) {
+        DrawWord(screen, box, words[w], x, y);
+        x += words[w].width() + 1;
+      }
+    }
+  }
+
+ private:
+  int LineEnd(size_t line) const {
+    return line + 1 < lines_->size() ? (*lines_)[line + 1]
+                                     : int(words_->words().size());
+  }
+
+  int LineWidth(size_t line) const {
+    const auto& words = words_->words();
+    const int begin = (*lines_)[line];
+    const int end = LineEnd(line);
+    return words[end - 1].end - words[begin].begin;
+  }
+
+  void DrawWord(Screen& screen,
+                const Box& box,
+                const Words::Word& word,
+                int x,
+                int y) {
+    const auto& cells = words_->cells();
+    for (int i = word.begin; i < word.end; ++i, ++x) {
+      if (x > box.x_max) {
+        return;
+      }
+      if (x >= box.x_min) {
+        screen.PixelAtRegistered(x, y).character = cells[i];
+      }
+    }
+  }
+
+  std::shared_ptr<Words> words_;
+  Alignment alignment_;
+  Words::Lines lines_;
+  int asked_ = std::numeric_limits<int>::max();
+  bool need_iteration_ = false;
+};
+
+Element MakeParagraph(const std::string& text, Alignment alignment) {
+  return MakeNode<Paragraph>(GetWords(text), alignment);
+}
+
 }  // namespace
 
 /// @brief Return an element drawing the paragraph on multiple lines.
 /// @ingroup dom
-/// @see flexbox.
+/// @see paragraphAlignLeft.
 Element paragraph(const std::string& the_text) {
   return paragraphAlignLeft(the_text);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
 /// the left.
+///
+/// The words are separated by spaces, and wrapped according to their display
+/// width. The words and the line breaks of the recent paragraphs are cached,
+/// so a paragraph drawn again costs only the drawing.
 /// @ingroup dom
-/// @see flexbox.
 Element paragraphAlignLeft(const std::string& the_text) {
-  static const auto config = FlexboxConfig().SetGap(1, 0);
-  return flexbox(Split(the_text), config);
+  return MakeParagraph(the_text, Alignment::Left);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
 /// the right.
 /// @ingroup dom
-/// @see flexbox.
+/// @see paragraphAlignLeft.
 Element paragraphAlignRight(const std::string& the_text) {
-  static const auto config =
-      FlexboxConfig().SetGap(1, 0).Set(FlexboxConfig::JustifyContent::FlexEnd);
-  return flexbox(Split(the_text), config);
+  return MakeParagraph(the_text, Alignment::Right);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned on
 /// the center.
 /// @ingroup dom
-/// @see flexbox.
+/// @see paragraphAlignLeft.
 Element paragraphAlignCenter(const std::string& the_text) {
-  static const auto config =
-      FlexboxConfig().SetGap(1, 0).Set(FlexboxConfig::JustifyContent::Center);
-  return flexbox(Split(the_text), config);
+  return MakeParagraph(the_text, Alignment::Center);
 }
 
 /// @brief Return an element drawing the paragraph on multiple lines, aligned
-/// using a justified alignment.
-/// the center.
+/// using a justified alignment. The last line is aligned on the left.
 /// @ingroup dom
-/// @see flexbox.
+/// @see paragraphAlignLeft.
 Element paragraphAlignJustify(const std::string& the_text) {
-  static const auto config = FlexboxConfig().SetGap(1, 0).Set(
-      FlexboxConfig::JustifyContent::SpaceBetween);
-  Elements words = Split(the_text);
-  words.push_back(text("") | xflex);
-  return flexbox(std::move(words), config);
+  return MakeParagraph(the_text, Alignment::Justify);
 }
 
 }  // namespace ftxui
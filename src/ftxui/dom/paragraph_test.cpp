@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <sstream>  // for basic_istream, stringstream
+#include <string>   // for string, allocator, getline
+
+#include "ftxui/dom/elements.hpp"  // for paragraph, paragraphAlignCenter, paragraphAlignJustify, paragraphAlignLeft, paragraphAlignRight, text, flexbox, vbox, xflex, operator|, Element, Elements
+#include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::JustifyContent
+#include "ftxui/dom/node.hpp"            // for Render
+#include "ftxui/screen/screen.hpp"       // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// The paragraph, built as a flexbox of words.
+Element FlexboxParagraph(const std::string& the_text,
+                         FlexboxConfig::JustifyContent justify_content) {
+  Elements words;
+  std::stringstream ss(the_text);
+  std::string word;
+  while (std::getline(ss, word, ' ')) {
+    words.push_back(text(word));
+  }
+  if (justify_content == FlexboxConfig::JustifyContent::SpaceBetween) {
+    words.push_back(text("") | xflex);
+  }
+  auto config = FlexboxConfig().SetGap(1, 0).Set(justify_content);
+  return flexbox(std::move(words), config);
+}
+
+std::string Draw(Element element, int width, int height = 4) {
+  Screen screen(width, height);
+  Render(screen, element);
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(ParagraphTest, Left) {
+  EXPECT_EQ(Draw(paragraphAlignLeft("aaa bb c dddd"), 7),
+            "aaa bb \r\n"
+            "c dddd \r\n"
+            "       \r\n"
+            "       ");
+}
+
+TEST(ParagraphTest, Right) {
+  EXPECT_EQ(Draw(paragraphAlignRight("aaa bb c dddd"), 7),
+            " aaa bb\r\n"
+            " c dddd\r\n"
+            "       \r\n"
+            "       ");
+}
+
+TEST(ParagraphTest, Center) {
+  EXPECT_EQ(Draw(paragraphAlignCenter("aaa bb c d"), 8),
+            "aaa bb c\r\n"
+            "   d    \r\n"
+            "        \r\n"
+            "        ");
+}
+
+TEST(ParagraphTest, Justify) {
+  EXPECT_EQ(Draw(paragraphAlignJustify("aa b c dd e f"), 10),
+            "aa b c  dd\r\n"
+            "e f       \r\n"
+            "          \r\n"
+            "          ");
+}
+
+TEST(ParagraphTest, WordLongerThanWidth) {
+  EXPECT_EQ(Draw(paragraph("a abcdefgh b"), 4),
+            "a   \r\n"
+            "abcd\r\n"
+            "b   \r\n"
+            "    ");
+}
+
+TEST(ParagraphTest, ConsecutiveSpaces) {
+  EXPECT_EQ(Draw(paragraph("a  b"), 4, 1), "a  b");
+  EXPECT_EQ(Draw(paragraph("a  b"), 3, 2),
+            "a  \r\n"
+            "b  ");
+}
+
+TEST(ParagraphTest, FullWidth) {
+  EXPECT_EQ(Draw(paragraph("測試 測試 a"), 9, 2),
+            "測試 測試\r\n"
+            "a        ");
+  EXPECT_EQ(Draw(paragraph("測試 測試 a"), 6, 3),
+            "測試  \r\n"
+            "測試 a\r\n"
+            "      ");
+}
+
+TEST(ParagraphTest, Requirement) {
+  auto element = paragraph("aaa bb c dddd");
+  element->ComputeRequirement();
+  EXPECT_EQ(element->requirement().min_x, 13);
+  EXPECT_EQ(element->requirement().min_y, 1);
+
+  element->SetAvailableWidth(7);
+  element->ComputeRequirement();
+  EXPECT_EQ(element->requirement().min_x, 6);
+  EXPECT_EQ(element->requirement().min_y, 2);
+}
+
+// The same text drawn again, at different widths, reuses the cached words and
+// line breaks.
+TEST(ParagraphTest, Cached) {
+  const std::string the_text = "aaa bb c dddd";
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(Draw(paragraph(the_text), 7, 2),
+              "aaa bb \r\n"
+              "c dddd ");
+    EXPECT_EQ(Draw(paragraph(the_text), 4, 4),
+              "aaa \r\n"
+              "bb c\r\n"
+              "dddd\r\n"
+              "    ");
+    EXPECT_EQ(Draw(paragraph(the_text), 13, 1), "aaa bb c dddd");
+  }
+}
+
+TEST(ParagraphTest, InsideVbox) {
+  auto element = vbox({
+      paragraph("aaa bb c dddd"),
+      text("-----"),
+  });
+  EXPECT_EQ(Draw(element, 5),
+            "aaa  \r\n"
+            "bb c \r\n"
+            "dddd \r\n"
+            "-----");
+}
+
+// The paragraphs are drawn like a flexbox of words.
+TEST(ParagraphTest, SameAsFlexbox) {
+  const std::string the_text =
+      "The quick brown fox  jumps over the lazy dog. A B C DD EEE FFFF";
+  using JustifyContent = FlexboxConfig::JustifyContent;
+  for (int width = 1; width < 70; ++width) {
+    EXPECT_EQ(
+        Draw(paragraphAlignLeft(the_text), width, 20),
+        Draw(FlexboxParagraph(the_text, JustifyContent::FlexStart), width, 20));
+    EXPECT_EQ(
+        Draw(paragraphAlignRight(the_text), width, 20),
+        Draw(FlexboxParagraph(the_text, JustifyContent::FlexEnd), width, 20));
+    EXPECT_EQ(
+        Draw(paragraphAlignCenter(the_text), width, 20),
+        Draw(FlexboxParagraph(the_text, JustifyContent::Center), width, 20));
+    EXPECT_EQ(Draw(paragraphAlignJustify(the_text), width, 20),
+              Draw(FlexboxParagraph(the_text, JustifyContent::SpaceBetween),
+                   width, 20));
+  }
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,8 +1,9 @@
-#include <memory>   // for make_shared, __shared_ptr_access
+#include <memory>   // for __shared_ptr_access
 #include <utility>  // for move
 #include <vector>   // for __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"     // for Element, unpack, Decorator, reflect
+#include "ftxui/dom/arena.hpp"        // for MakeNode
+#include "ftxui/dom/elements.hpp"     // for Element, Decorator, reflect
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -14,7 +15,7 @@ namespace ftxui {
 class Reflect : public Node {
  public:
   Reflect(Element child, Box& box)
-      : Node(unpack(std::move(child))), reflected_box_(box) {}
+      : Node(std::move(child)), reflected_box_(box) {}
 
   void ComputeRequirement() final {
     Node::ComputeRequirement();
@@ -22,13 +23,15 @@ class Reflect : public Node {
   }
 
   void SetBox(Box box) final {
-    reflected_box_ = box;
+    // Empty, until rendered. Elements outside of the stencil aren't rendered,
+    // and must not be hovered.
+    reflected_box_ = Box{0, -1, 0, -1};
     Node::SetBox(box);
     children_[0]->SetBox(box);
   }
 
   void Render(Screen& screen) final {
-    reflected_box_ = Box::Intersection(screen.stencil, reflected_box_);
+    reflected_box_ = Box::Intersection(screen.stencil, box_);
     return Node::Render(screen);
   }
 
@@ -38,7 +41,7 @@ class Reflect : public Node {
 
 Decorator reflect(Box& box) {
   return [&](Element child) -> Element {
-    return std::make_shared<Reflect>(std::move(child), box);
+    return MakeNode<Reflect>(std::move(child), box);
   };
 }
 
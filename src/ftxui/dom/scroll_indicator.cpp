@@ -1,9 +1,10 @@
 #include <algorithm>  // for max
-#include <memory>     // for make_shared, __shared_ptr_access
+#include <memory>     // for __shared_ptr_access
 #include <string>     // for string
 #include <utility>    // for move
 #include <vector>     // for __alloc_traits<>::value_type
 
+#include "ftxui/dom/arena.hpp"           // for MakeNode
 #include "ftxui/dom/elements.hpp"        // for Element, vscroll_indicator
 #include "ftxui/dom/node.hpp"            // for Node, Elements
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
@@ -61,12 +62,12 @@ Element vscroll_indicator(Element child) {
         const bool down = (start_y <= y_down) && (y_down <= start_y + size);
 
         const char* c = up ? (down ? "┃" : "╹") : (down ? "╻" : " ");  // NOLINT
-        screen.PixelAt(x, y) = Pixel();
-        screen.PixelAt(x, y).character = c;
+        screen.PixelAtRegistered(x, y) = Pixel();
+        screen.PixelAtRegistered(x, y).character = c;
       }
     }
   };
-  return std::make_shared<Impl>(std::move(child));
+  return MakeNode<Impl>(std::move(child));
 }
 
 }  // namespace ftxui
@@ -1,8 +1,9 @@
 #include <array>    // for array, array<>::value_type
-#include <memory>   // for make_shared, allocator
+#include <memory>   // for allocator
 #include <string>   // for basic_string, string
 #include <utility>  // for move
 
+#include "ftxui/dom/arena.hpp"     // for MakeNode
 #include "ftxui/dom/elements.hpp"  // for Element, BorderStyle, LIGHT, separator, DOUBLE, EMPTY, HEAVY, separatorCharacter, separatorDouble, separatorEmpty, separatorHSelector, separatorHeavy, separatorLight, separatorStyled, separatorVSelector
 #include "ftxui/dom/node.hpp"      // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
@@ -37,13 +38,15 @@ class Separator : public Node {
   }
 
   void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        Pixel& pixel = screen.PixelAt(x, y);
+    const Box box = Box::Intersection(box_, screen.stencil);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        Pixel& pixel = screen.PixelAtRegistered(x, y);
         pixel.character = value_;
         pixel.automerge = true;
       }
     }
+    screen.RegisterAutomerge(box);
   }
 
   std::string value_;
@@ -64,13 +67,15 @@ class SeparatorAuto : public Node {
 
     const std::string c = charsets[style_][int(is_line && !is_column)];
 
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        Pixel& pixel = screen.PixelAt(x, y);
+    const Box box = Box::Intersection(box_, screen.stencil);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        Pixel& pixel = screen.PixelAtRegistered(x, y);
         pixel.character = c;
         pixel.automerge = true;
       }
     }
+    screen.RegisterAutomerge(box);
   }
 
   BorderStyle style_;
@@ -83,11 +88,13 @@ class SeparatorWithPixel : public SeparatorAuto {
     pixel_.automerge = true;
   }
   void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y) = pixel_;
+    const Box box = Box::Intersection(box_, screen.stencil);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        screen.PixelAtRegistered(x, y) = pixel_;
       }
     }
+    screen.RegisterAutomerge(box);
   }
 
  private:
@@ -128,7 +135,7 @@ class SeparatorWithPixel : public SeparatorAuto {
 /// down
 /// ```
 Element separator() {
-  return std::make_shared<SeparatorAuto>(LIGHT);
+  return MakeNode<SeparatorAuto>(LIGHT);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -166,7 +173,7 @@ Element separator() {
 /// down
 /// ```
 Element separatorStyled(BorderStyle style) {
-  return std::make_shared<SeparatorAuto>(style);
+  return MakeNode<SeparatorAuto>(style);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -203,7 +210,7 @@ Element separatorStyled(BorderStyle style) {
 /// down
 /// ```
 Element separatorLight() {
-  return std::make_shared<SeparatorAuto>(LIGHT);
+  return MakeNode<SeparatorAuto>(LIGHT);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -240,7 +247,7 @@ Element separatorLight() {
 /// down
 /// ```
 Element separatorDashed() {
-  return std::make_shared<SeparatorAuto>(DASHED);
+  return MakeNode<SeparatorAuto>(DASHED);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -277,7 +284,7 @@ Element separatorDashed() {
 /// down
 /// ```
 Element separatorHeavy() {
-  return std::make_shared<SeparatorAuto>(HEAVY);
+  return MakeNode<SeparatorAuto>(HEAVY);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -314,7 +321,7 @@ Element separatorHeavy() {
 /// down
 /// ```
 Element separatorDouble() {
-  return std::make_shared<SeparatorAuto>(DOUBLE);
+  return MakeNode<SeparatorAuto>(DOUBLE);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -351,7 +358,7 @@ Element separatorDouble() {
 /// down
 /// ```
 Element separatorEmpty() {
-  return std::make_shared<SeparatorAuto>(EMPTY);
+  return MakeNode<SeparatorAuto>(EMPTY);
 }
 
 /// @brief Draw a vertical or horizontal separation in between two other
@@ -389,7 +396,7 @@ Element separatorEmpty() {
 /// down
 /// ```
 Element separatorCharacter(std::string value) {
-  return std::make_shared<Separator>(std::move(value));
+  return MakeNode<Separator>(std::move(value));
 }
 
 /// @brief Draw a separator in between two element filled with a given pixel.
@@ -420,7 +427,7 @@ Element separatorCharacter(std::string value) {
 /// Down
 /// ```
 Element separator(Pixel pixel) {
-  return std::make_shared<SeparatorWithPixel>(std::move(pixel));
+  return MakeNode<SeparatorWithPixel>(std::move(pixel));
 }
 
 /// @brief Draw an horizontal bar, with the area in between left/right colored
@@ -462,7 +469,7 @@ Element separatorHSelector(float left,
 
       const int y = box_.y_min;
       for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        Pixel& pixel = screen.PixelAt(x, y);
+        Pixel& pixel = screen.PixelAtRegistered(x, y);
 
         const int a = (x - box_.x_min) * 2;
         const int b = a + 1;
@@ -483,6 +490,7 @@ Element separatorHSelector(float left,
           pixel.foreground_color = unselected_color_;
         }
       }
+      screen.RegisterAutomerge(box_);
     }
 
     float left_;
@@ -490,7 +498,7 @@ Element separatorHSelector(float left,
     Color unselected_color_;
     Color selected_color_;
   };
-  return std::make_shared<Impl>(left, right, unselected_color, selected_color);
+  return MakeNode<Impl>(left, right, unselected_color, selected_color);
 }
 
 /// @brief Draw an vertical bar, with the area in between up/downcolored
@@ -532,7 +540,7 @@ Element separatorVSelector(float up,
 
       const int x = box_.x_min;
       for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        Pixel& pixel = screen.PixelAt(x, y);
+        Pixel& pixel = screen.PixelAtRegistered(x, y);
 
         const int a = (y - box_.y_min) * 2;
         const int b = a + 1;
@@ -553,6 +561,7 @@ Element separatorVSelector(float up,
           pixel.foreground_color = unselected_color_;
         }
       }
+      screen.RegisterAutomerge(box_);
     }
 
     float up_;
@@ -560,7 +569,7 @@ Element separatorVSelector(float up,
     Color unselected_color_;
     Color selected_color_;
   };
-  return std::make_shared<Impl>(up, down, unselected_color, selected_color);
+  return MakeNode<Impl>(up, down, unselected_color, selected_color);
 }
 
 }  // namespace ftxui
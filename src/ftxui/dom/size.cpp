@@ -1,9 +1,10 @@
 #include <algorithm>  // for min, max
-#include <memory>     // for make_shared, __shared_ptr_access
+#include <memory>     // for __shared_ptr_access
 #include <utility>    // for move
 #include <vector>     // for __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for Constraint, WidthOrHeight, EQUAL, GREATER_THAN, LESS_THAN, WIDTH, unpack, Decorator, Element, size
+#include "ftxui/dom/arena.hpp"     // for MakeNode
+#include "ftxui/dom/elements.hpp"  // for Constraint, WidthOrHeight, EQUAL, GREATER_THAN, LESS_THAN, WIDTH, Decorator, Element, size
 #include "ftxui/dom/node.hpp"      // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -13,7 +14,7 @@ namespace ftxui {
 class Size : public Node {
  public:
   Size(Element child, WidthOrHeight direction, Constraint constraint, int value)
-      : Node(unpack(std::move(child))),
+      : Node(std::move(child)),
         direction_(direction),
         constraint_(constraint),
         value_(value) {}
@@ -84,7 +85,7 @@ class Size : public Node {
 /// @ingroup dom
 Decorator size(WidthOrHeight direction, Constraint constraint, int value) {
   return [=](Element e) {
-    return std::make_shared<Size>(std::move(e), direction, constraint, value);
+    return MakeNode<Size>(std::move(e), direction, constraint, value);
   };
 }
 
@@ -1,9 +1,10 @@
 #include <algorithm>  // for min
-#include <memory>     // for make_shared
+#include <memory>     // for shared_ptr
 #include <string>     // for string, wstring
 #include <utility>    // for move
 #include <vector>     // for vector
 
+#include "ftxui/dom/arena.hpp"        // for MakeNode
 #include "ftxui/dom/deprecated.hpp"   // for text, vtext
 #include "ftxui/dom/elements.hpp"     // for Element, text, vtext
 #include "ftxui/dom/node.hpp"         // for Node
@@ -31,11 +32,14 @@ class Text : public Node {
     if (y > box_.y_max) {
       return;
     }
-    for (const auto& cell : Utf8ToGlyphs(text_)) {
+    // Reused from one element to the next, so rendering doesn't allocate.
+    thread_local std::vector<std::string> glyphs;
+    Utf8ToGlyphs(text_, &glyphs);
+    for (const auto& cell : glyphs) {
       if (x > box_.x_max) {
         return;
       }
-      screen.PixelAt(x, y).character = cell;
+      screen.PixelAtRegistered(x, y).character = cell;
       ++x;
     }
   }
@@ -60,11 +64,13 @@ class VText : public Node {
     if (x + width_ - 1 > box_.x_max) {
       return;
     }
-    for (const auto& it : Utf8ToGlyphs(text_)) {
+    thread_local std::vector<std::string> glyphs;
+    Utf8ToGlyphs(text_, &glyphs);
+    for (const auto& it : glyphs) {
       if (y > box_.y_max) {
         return;
       }
-      screen.PixelAt(x, y).character = it;
+      screen.PixelAtRegistered(x, y).character = it;
       y += 1;
     }
   }
@@ -90,7 +96,7 @@ class VText : public Node {
 /// Hello world!
 /// ```
 Element text(std::string text) {
-  return std::make_shared<Text>(std::move(text));
+  return MakeNode<Text>(std::move(text));
 }
 
 /// @brief Display a piece of unicode text.
@@ -109,7 +115,7 @@ Element text(std::string text) {
 /// Hello world!
 /// ```
 Element text(std::wstring text) {  // NOLINT
-  return std::make_shared<Text>(to_string(text));
+  return MakeNode<Text>(to_string(text));
 }
 
 /// @brief Display a piece of unicode text vertically.
@@ -139,7 +145,7 @@ Element text(std::wstring text) {  // NOLINT
 /// !
 /// ```
 Element vtext(std::string text) {
-  return std::make_shared<VText>(std::move(text));
+  return MakeNode<VText>(std::move(text));
 }
 
 /// @brief Display a piece unicode text vertically.
@@ -169,7 +175,7 @@ Element vtext(std::string text) {
 /// !
 /// ```
 Element vtext(std::wstring text) {  // NOLINT
-  return std::make_shared<VText>(to_string(text));
+  return MakeNode<VText>(to_string(text));
 }
 
 }  // namespace ftxui
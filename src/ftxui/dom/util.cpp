@@ -1,12 +1,14 @@
 #include <algorithm>    // for min
 #include <functional>   // for function
-#include <memory>       // for __shared_ptr_access, make_unique
+#include <memory>       // for __shared_ptr_access
 #include <type_traits>  // for remove_reference, remove_reference<>::type
 #include <utility>      // for move
 #include <vector>       // for vector
 
+#include "ftxui/dom/arena.hpp"     // for MakeNode
 #include "ftxui/dom/elements.hpp"  // for Element, Decorator, Elements, operator|, Fit, emptyElement, nothing, operator|=
-#include "ftxui/dom/node.hpp"      // for Node, Node::Status
+#include "ftxui/dom/layout.hpp"    // for Layout
+#include "ftxui/dom/node.hpp"      // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
 #include "ftxui/screen/screen.hpp"    // for Full
@@ -96,29 +98,20 @@ Dimensions Dimension::Fit(Element& e) {
   box.x_max = fullsize.dimx;
   box.y_max = fullsize.dimy;
 
-  Node::Status status;
-  e->Check(&status);
-  const int max_iteration = 20;
-  while (status.need_iteration && status.iteration < max_iteration) {
-    e->ComputeRequirement();
-
-    // Don't give the element more space than it needs:
-    box.x_max = std::min(box.x_max, e->requirement().min_x);
-    box.y_max = std::min(box.y_max, e->requirement().min_y);
-
-    e->SetBox(box);
-    status.need_iteration = false;
-    status.iteration++;
-    e->Check(&status);
-
-    if (!status.need_iteration) {
-      break;
-    }
-    // Increase the size of the box until it fits, but not more than the with of
-    // the terminal emulator:
-    box.x_max = std::min(e->requirement().min_x, fullsize.dimx);
-    box.y_max = std::min(e->requirement().min_y, fullsize.dimy);
-  }
+  // The requirement of the previous iteration.
+  Requirement previous;
+  previous.min_x = fullsize.dimx;
+  previous.min_y = fullsize.dimy;
+
+  Layout(e.get(), fullsize.dimx, [&](const Requirement& requirement) {
+    // Increase the size of the box until it fits, but not more than the with
+    // of the terminal emulator. Don't give the element more space than it
+    // needs:
+    box.x_max = std::min({requirement.min_x, previous.min_x, fullsize.dimx});
+    box.y_max = std::min({requirement.min_y, previous.min_y, fullsize.dimy});
+    previous = requirement;
+    return box;
+  });
 
   return {
       box.x_max,
@@ -135,7 +128,7 @@ Element emptyElement() {
       requirement_.min_y = 0;
     }
   };
-  return std::make_unique<Impl>();
+  return MakeNode<Impl>();
 }
 
 }  // namespace ftxui
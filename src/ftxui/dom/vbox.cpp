@@ -1,14 +1,16 @@
-#include <algorithm>  // for max
+#include <algorithm>  // for max, partition_point
 #include <cstddef>    // for size_t
-#include <memory>  // for __shared_ptr_access, shared_ptr, make_shared, allocator_traits<>::value_type
+#include <memory>  // for __shared_ptr_access, shared_ptr, allocator_traits<>::value_type
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
+#include "ftxui/dom/arena.hpp"        // for MakeNode
 #include "ftxui/dom/box_helper.hpp"   // for Element, Compute
 #include "ftxui/dom/elements.hpp"     // for Element, Elements, vbox
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
 
 namespace ftxui {
 
@@ -25,6 +27,7 @@ class VBox : public Node {
     requirement_.flex_shrink_y = 0;
     requirement_.selection = Requirement::NORMAL;
     for (auto& child : children_) {
+      child->SetAvailableWidth(available_width_);
       child->ComputeRequirement();
       if (requirement_.selection < child->requirement().selection) {
         requirement_.selection = child->requirement().selection;
@@ -41,7 +44,7 @@ class VBox : public Node {
   void SetBox(Box box) override {
     Node::SetBox(box);
 
-    std::vector<box_helper::Element> elements(children_.size());
+    box_helper::Elements elements(children_.size());
     for (size_t i = 0; i < children_.size(); ++i) {
       auto& element = elements[i];
       const auto& requirement = children_[i]->requirement();
@@ -60,6 +63,22 @@ class VBox : public Node {
       y = box.y_max + 1;
     }
   }
+
+  void Render(Screen& screen) override {
+    // The children are laid out in order, so the visible ones are contiguous.
+    // Find them by bisection, to avoid visiting the others.
+    const Box& stencil = screen.stencil;
+    auto it = std::partition_point(
+        children_.begin(), children_.end(), [&](const Element& child) {
+          const Box& box = child->box();
+          return std::max(box.y_min, box.y_max) < stencil.y_min;
+        });
+    for (; it != children_.end() && (*it)->box().y_min <= stencil.y_max; ++it) {
+      if ((*it)->IsVisible(screen)) {
+        (*it)->Render(screen);
+      }
+    }
+  }
 };
 
 /// @brief A container displaying elements vertically one by one.
@@ -76,7 +95,7 @@ class VBox : public Node {
 /// });
 /// ```
 Element vbox(Elements children) {
-  return std::make_shared<VBox>(std::move(children));
+  return MakeNode<VBox>(std::move(children));
 }
 
 }  // namespace ftxui
@@ -0,0 +1,130 @@
+#include <algorithm>   // for max, min
+#include <climits>     // for INT_MAX
+#include <cstddef>     // for size_t
+#include <functional>  // for function
+#include <memory>      // for shared_ptr
+#include <utility>     // for move
+
+#include "ftxui/dom/arena.hpp"        // for MakeNode
+#include "ftxui/dom/elements.hpp"     // for Element, virtualList
+#include "ftxui/dom/layout.hpp"       // for Layout
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::SELECTED
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+
+class VirtualList : public Node {
+ public:
+  VirtualList(size_t count,
+              int row_height,
+              std::function<Element(size_t)> row,
+              size_t selected)
+      : row_height_(std::max(1, row_height)),
+        // The height of the list must fit in an int, with room left for the
+        // offset of its box.
+        count_(int(std::min(count, size_t(INT_MAX / 2 / row_height_)))),
+        row_(std::move(row)),
+        selected_(selected < size_t(count_) ? int(selected) : -1) {}
+
+  void ComputeRequirement() override {
+    requirement_ = Requirement();
+    requirement_.min_y = count_ * row_height_;
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_shrink_x = 1;
+
+    // Only the selected row is built, for the frame to scroll to it.
+    selected_row_ = nullptr;
+    if (selected_ < 0) {
+      return;
+    }
+    selected_row_ = row_(size_t(selected_));
+    selected_row_->ComputeRequirement();
+    const Requirement& requirement = selected_row_->requirement();
+    requirement_.selection = std::max(Requirement::SELECTED,  //
+                                      requirement.selection);
+    if (requirement.selection == Requirement::NORMAL) {
+      requirement_.selected_box = {0, requirement.min_x - 1,  //
+                                   0, row_height_ - 1};
+    } else {
+      requirement_.selected_box = requirement.selected_box;
+    }
+    requirement_.selected_box.y_min += selected_ * row_height_;
+    requirement_.selected_box.y_max += selected_ * row_height_;
+  }
+
+  void Render(Screen& screen) override {
+    const Box visible = Box::Intersection(box_, screen.stencil);
+    if (count_ == 0 || visible.y_min > visible.y_max) {
+      return;
+    }
+
+    // Build, layout and draw the visible rows only.
+    const int first = (visible.y_min - box_.y_min) / row_height_;
+    const int last = std::min(count_ - 1,  //
+                              (visible.y_max - box_.y_min) / row_height_);
+    for (int i = first; i <= last; ++i) {
+      const Element row = (i == selected_) ? selected_row_ : row_(size_t(i));
+      Box box = box_;
+      box.y_min = box_.y_min + i * row_height_;
+      box.y_max = box.y_min + row_height_ - 1;
+      Layout(row.get(), box);
+      row->Render(screen);
+    }
+  }
+
+ private:
+  int row_height_;
+  int count_;
+  std::function<Element(size_t)> row_;
+  int selected_;  // -1 when none.
+  Element selected_row_;
+};
+
+}  // namespace
+
+/// @brief A vertical list of |count| rows of |row_height| lines, building only
+/// the rows being displayed.
+///
+/// It is meant to be used inside a `frame` or a `yframe`: a `vbox` over a large
+/// collection builds every row at every frame, while `virtualList` calls |row|
+/// only for the visible ones. The cost doesn't depend on |count|.
+///
+/// The list fills the available width. Each row is given |row_height| lines.
+///
+/// Since the rows are not all built, the list can't find the one decorated
+/// with `focus` or `select` by itself. The index of this row is given by
+/// |selected|. The frame scrolls to make it visible, like for a `vbox`.
+///
+/// @param count The number of rows.
+/// @param row_height The height of every row.
+/// @param row Builds the row at a given index.
+/// @param selected The index of the selected row, or size_t(-1) if none.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// auto document = virtualList(entries.size(), 1, [&](size_t i) {
+///   auto element = text(entries[i]);
+///   if (i == selected) {
+///     element |= inverted | focus;
+///   }
+///   return element;
+/// }, selected) | frame;
+/// ```
+Element virtualList(size_t count,
+                    int row_height,
+                    std::function<Element(size_t)> row,
+                    size_t selected) {
+  return MakeNode<VirtualList>(count, row_height, std::move(row), selected);
+}
+
+}  // namespace ftxui
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <cstddef>  // for size_t
+#include <string>   // for to_string
+
+#include "ftxui/dom/elements.hpp"  // for virtualList, text, frame, focus, vbox, separator, operator|, Element
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(VirtualListTest, Basic) {
+  int built = 0;
+  auto root = virtualList(1000000, 1, [&](size_t i) {
+                built++;
+                return text(std::to_string(i));
+              }) |
+              frame;
+
+  Screen screen(3, 3);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "0  \r\n"
+            "1  \r\n"
+            "2  ");
+  EXPECT_EQ(built, 3);
+}
+
+TEST(VirtualListTest, Empty) {
+  auto root = vbox({
+      virtualList(0, 1, [](size_t) { return text("x"); }),
+      text("end"),
+  });
+
+  Screen screen(3, 2);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "end\r\n"
+            "   ");
+}
+
+TEST(VirtualListTest, Selected) {
+  int built = 0;
+  auto row = [&](size_t i) {
+    built++;
+    auto element = text(std::to_string(i));
+    if (i == 500) {
+      element |= focus;
+    }
+    return element;
+  };
+  auto root = virtualList(1000, 1, row, 500) | frame;
+
+  Screen screen(3, 3);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "499\r\n"
+            "500\r\n"
+            "501");
+  // The selected row is built once, and reused when drawn.
+  EXPECT_EQ(built, 3);
+}
+
+TEST(VirtualListTest, SelectedWithoutFocus) {
+  auto row = [](size_t i) { return text(std::to_string(i)); };
+  auto root = virtualList(1000, 1, row, 999) | frame;
+
+  Screen screen(3, 2);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "998\r\n"
+            "999");
+}
+
+TEST(VirtualListTest, RowHeight) {
+  auto row = [](size_t i) {
+    return vbox({
+        text(std::to_string(i)),
+        separator(),
+    });
+  };
+  auto root = virtualList(100, 2, row, 10) | frame;
+
+  Screen screen(2, 4);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "──\r\n"
+            "10\r\n"
+            "──\r\n"
+            "11");
+}
+
+// The height of the list doesn't overflow, even for huge counts.
+TEST(VirtualListTest, HugeCount) {
+  auto row = [](size_t i) { return text(std::to_string(i)); };
+  Screen screen(3, 3);
+
+  Render(screen, virtualList(size_t(-2), 1, row, 500) | frame);
+  EXPECT_EQ(screen.ToString(),
+            "499\r\n"
+            "500\r\n"
+            "501");
+
+  screen.Clear();
+  Render(screen, virtualList(size_t(-2), 1000, row) | frame);
+  EXPECT_EQ(screen.ToString(),
+            "0  \r\n"
+            "   \r\n"
+            "   ");
+
+  // A selected row past the rows that can be displayed is ignored.
+  screen.Clear();
+  Render(screen, virtualList(size_t(-2), 1000, row, size_t(-3)) | frame);
+  EXPECT_EQ(screen.ToString(),
+            "0  \r\n"
+            "   \r\n"
+            "   ");
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
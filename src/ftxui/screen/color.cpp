@@ -6,6 +6,7 @@
 
 #include "ftxui/screen/color_info.hpp"  // for GetColorInfo, ColorInfo
 #include "ftxui/screen/terminal.hpp"  // for ColorSupport, Color, Palette256, TrueColor
+#include "ftxui/screen/util.hpp"  // for AppendDecimal
 
 namespace ftxui {
 
@@ -43,22 +44,35 @@ bool Color::operator!=(const Color& rhs) const {
 }
 
 std::string Color::Print(bool is_background_color) const {
+  std::string out;
+  AppendTo(out, is_background_color);
+  return out;
+}
+
+void Color::AppendTo(std::string& out, bool is_background_color) const {
   switch (type_) {
     case ColorType::Palette1:
-      return is_background_color ? "49"s : "39"s;
+      out += is_background_color ? "49"sv : "39"sv;
+      return;
 
     case ColorType::Palette16:
-      return palette16code[2 * red_ + is_background_color];  // NOLINT;
+      out += palette16code[2 * red_ + is_background_color];  // NOLINT;
+      return;
 
     case ColorType::Palette256:
-      return (is_background_color ? "48;5;"s : "38;5;"s) + std::to_string(red_);
+      out += is_background_color ? "48;5;"sv : "38;5;"sv;
+      util::AppendDecimal(out, red_);
+      return;
 
     case ColorType::TrueColor:
     default:
-      return (is_background_color ? "48;2;"s : "38;2;"s)  //
-             + std::to_string(red_) + ";"                 //
-             + std::to_string(green_) + ";"               //
-             + std::to_string(blue_);                     //
+      out += is_background_color ? "48;2;"sv : "38;2;"sv;
+      util::AppendDecimal(out, red_);
+      out += ';';
+      util::AppendDecimal(out, green_);
+      out += ';';
+      util::AppendDecimal(out, blue_);
+      return;
   }
 }
 
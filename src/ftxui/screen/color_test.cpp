@@ -28,6 +28,16 @@ TEST(ColorTest, PrintTrueCOlor) {
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(true), "48;2;1;2;3");
 }
 
+TEST(ColorTest, AppendTo) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  std::string out = "prefix:";
+  Color::RGB(0, 10, 255).AppendTo(out, false);
+  EXPECT_EQ(out, "prefix:38;2;0;10;255");
+  out.clear();
+  Color(Color::DarkRed).AppendTo(out, true);
+  EXPECT_EQ(out, "48;5;52");
+}
+
 TEST(ColorTest, FallbackTo256) {
   Terminal::SetColorSupport(Terminal::Color::Palette256);
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(false), "38;5;16");
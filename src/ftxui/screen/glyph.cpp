@@ -0,0 +1,223 @@
+#include "ftxui/screen/glyph.hpp"
+
+#include <algorithm>    // for min
+#include <cstring>      // for strlen
+#include <ostream>      // for ostream
+#include <string_view>  // for string_view
+
+#include "ftxui/screen/intern_table.hpp"  // for InternTable
+#include "ftxui/screen/string.hpp"        // for string_width
+
+namespace ftxui {
+
+namespace {
+
+// See the layout of Glyph::value_. When |kInterned| is set, the payload is an
+// index into the InternTable. Otherwise, this is the codepoint, or |kEmpty|.
+constexpr uint32_t kInterned = 0x8000'0000;
+constexpr uint32_t kPayloadMask = 0x1FFF'FFFF;
+constexpr uint32_t kEmpty = 0x0011'0000;  // The first value after Unicode.
+constexpr uint32_t kMaxCodepoint = 0x0010'FFFF;
+
+// The glyphs made of several codepoints. Entries are never removed, so that
+// indices remain valid for the whole program. The table is bounded, so that
+// drawing an endless stream of distinct graphemes doesn't grow the memory
+// forever. Past the bound, new graphemes are reduced to their first codepoint.
+constexpr size_t kMaxInternedGlyphs = 1 << 16;
+constexpr size_t kMaxInternedBytes = 1 << 20;
+
+InternTable& GetInternTable() {
+  static InternTable table(kMaxInternedGlyphs, kMaxInternedBytes);
+  return table;
+}
+
+// Write the UTF-8 representation of |codepoint| into |out|. Return the number
+// of bytes written.
+size_t EncodeUTF8(uint32_t codepoint, char* out) {
+  // NOLINTBEGIN
+  if (codepoint < 0x80) {
+    out[0] = char(codepoint);
+    return 1;
+  }
+  if (codepoint < 0x800) {
+    out[0] = char(0b1100'0000 | (codepoint >> 6));
+    out[1] = char(0b1000'0000 | (codepoint & 0b0011'1111));
+    return 2;
+  }
+  if (codepoint < 0x10000) {
+    out[0] = char(0b1110'0000 | (codepoint >> 12));
+    out[1] = char(0b1000'0000 | ((codepoint >> 6) & 0b0011'1111));
+    out[2] = char(0b1000'0000 | (codepoint & 0b0011'1111));
+    return 3;
+  }
+  out[0] = char(0b1111'0000 | (codepoint >> 18));
+  out[1] = char(0b1000'0000 | ((codepoint >> 12) & 0b0011'1111));
+  out[2] = char(0b1000'0000 | ((codepoint >> 6) & 0b0011'1111));
+  out[3] = char(0b1000'0000 | (codepoint & 0b0011'1111));
+  return 4;
+  // NOLINTEND
+}
+
+size_t CodepointSize(uint32_t codepoint) {
+  char buffer[4];  // NOLINT
+  return EncodeUTF8(codepoint, buffer);
+}
+
+// Decode |str| if it is made of exactly one codepoint, using the shortest
+// encoding. Anything else must be interned to be restored byte for byte.
+bool DecodeSingleCodepoint(std::string_view str, uint32_t* codepoint) {
+  // NOLINTBEGIN
+  if (str.empty() || str.size() > 4) {
+    return false;
+  }
+  const auto head = uint8_t(str[0]);
+  size_t size = 0;
+  uint32_t value = 0;
+  if ((head & 0b1000'0000) == 0) {
+    size = 1;
+    value = head;
+  } else if ((head & 0b1110'0000) == 0b1100'0000) {
+    size = 2;
+    value = head & 0b0001'1111;
+  } else if ((head & 0b1111'0000) == 0b1110'0000) {
+    size = 3;
+    value = head & 0b0000'1111;
+  } else if ((head & 0b1111'1000) == 0b1111'0000) {
+    size = 4;
+    value = head & 0b0000'0111;
+  } else {
+    return false;
+  }
+
+  if (size != str.size()) {
+    return false;
+  }
+
+  for (size_t i = 1; i < size; ++i) {
+    const auto byte = uint8_t(str[i]);
+    if ((byte & 0b1100'0000) != 0b1000'0000) {
+      return false;
+    }
+    value = (value << 6) + (byte & 0b0011'1111);
+  }
+  // NOLINTEND
+
+  if (value > kMaxCodepoint || CodepointSize(value) != size) {
+    return false;
+  }
+
+  *codepoint = value;
+  return true;
+}
+
+// Return the first codepoint of |str|, or U+FFFD when it isn't valid UTF-8.
+uint32_t FirstCodepoint(std::string_view str) {
+  const auto head = uint8_t(str[0]);
+  // NOLINTNEXTLINE
+  const size_t size = head < 0xC0 ? 1 : head < 0xE0 ? 2 : head < 0xF0 ? 3 : 4;
+  uint32_t codepoint = 0;
+  if (!DecodeSingleCodepoint(str.substr(0, size), &codepoint)) {
+    return 0xFFFD;  // NOLINT
+  }
+  return codepoint;
+}
+
+int Width(std::string_view str) {
+  // Quick path for printable ASCII:
+  if (str.size() == 1 && str[0] >= ' ' && str[0] <= '~') {
+    return 1;
+  }
+  return std::min(string_width(std::string(str)), 2);
+}
+
+}  // namespace
+
+/// @brief A glyph representing a space.
+Glyph::Glyph() : value_(' ' | (1U << kWidthShift)) {}
+
+/// @brief Build a glyph from its UTF-8 representation.
+Glyph::Glyph(const char* str) : value_(Encode({str, std::strlen(str)})) {}
+
+/// @brief Build a glyph from its UTF-8 representation.
+Glyph::Glyph(const std::string& str) : value_(Encode(str)) {}
+
+/// @brief Build a glyph made of a single codepoint.
+// static
+Glyph Glyph::FromCodepoint(uint32_t codepoint) {
+  if (codepoint > kMaxCodepoint) {
+    return Glyph(kEmpty);
+  }
+  char buffer[4];  // NOLINT
+  const std::string_view str(buffer, EncodeUTF8(codepoint, buffer));
+  return Glyph(codepoint | (uint32_t(Width(str)) << kWidthShift));
+}
+
+// static
+uint32_t Glyph::Encode(std::string_view str) {
+  if (str.empty()) {
+    return kEmpty;
+  }
+  uint32_t value = 0;
+  if (!DecodeSingleCodepoint(str, &value)) {
+    const uint32_t id = GetInternTable().Intern(str);
+    value = id != InternTable::kNotFound ? kInterned | id
+                                         : FirstCodepoint(str);
+  }
+  return value | (uint32_t(Width(str)) << kWidthShift);
+}
+
+bool Glyph::IsInterned() const {
+  return value_ & kInterned;
+}
+
+uint32_t Glyph::payload() const {
+  return value_ & kPayloadMask;
+}
+
+uint32_t Glyph::codepoint() const {
+  return (IsInterned() || value_ == kEmpty) ? 0 : payload();
+}
+
+/// @brief Return the UTF-8 representation of the glyph.
+std::string Glyph::str() const {
+  std::string out;
+  AppendTo(out);
+  return out;
+}
+
+/// @brief Append the UTF-8 representation of the glyph to |out|.
+void Glyph::AppendTo(std::string& out) const {
+  if (IsInterned()) {
+    out += GetInternTable().Get(payload());
+    return;
+  }
+  if (value_ == kEmpty) {
+    return;
+  }
+  char buffer[4];  // NOLINT
+  out.append(buffer, EncodeUTF8(payload(), buffer));
+}
+
+size_t Glyph::size() const {
+  if (IsInterned()) {
+    return GetInternTable().Get(payload()).size();
+  }
+  if (value_ == kEmpty) {
+    return 0;
+  }
+  return CodepointSize(payload());
+}
+
+bool Glyph::empty() const {
+  return value_ == kEmpty;
+}
+
+std::ostream& operator<<(std::ostream& out, const Glyph& glyph) {
+  return out << glyph.str();
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <string>  // for allocator, string
+
+#include "ftxui/screen/glyph.hpp"   // for Glyph
+#include "ftxui/screen/screen.hpp"  // for Pixel
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(GlyphTest, Default) {
+  EXPECT_EQ(Glyph(), " ");
+  EXPECT_EQ(Glyph().str(), " ");
+  EXPECT_EQ(Glyph().codepoint(), uint32_t(' '));
+}
+
+TEST(GlyphTest, Empty) {
+  Glyph glyph = "";
+  EXPECT_TRUE(glyph.empty());
+  EXPECT_EQ(glyph.size(), 0u);
+  EXPECT_EQ(glyph.str(), "");
+  EXPECT_NE(glyph, Glyph(std::string(1, '\0')));
+}
+
+TEST(GlyphTest, SingleCodepoint) {
+  for (const std::string str : {"a", "é", "─", "测", "🎉"}) {
+    Glyph glyph = str;
+    EXPECT_EQ(glyph.str(), str);
+    EXPECT_EQ(glyph.size(), str.size());
+    EXPECT_NE(glyph.codepoint(), 0u);
+    EXPECT_EQ(glyph, str);
+  }
+  EXPECT_EQ(Glyph("─").codepoint(), 0x2500u);
+  EXPECT_EQ(Glyph::FromCodepoint(0x2500), "─");
+}
+
+TEST(GlyphTest, Interned) {
+  const std::string combining = "a⃦";
+  Glyph a = combining;
+  Glyph b = std::string("a⃦");
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, Glyph("a"));
+  EXPECT_EQ(a.str(), combining);
+  EXPECT_EQ(a.size(), combining.size());
+  EXPECT_EQ(a.codepoint(), 0u);
+
+  // Invalid UTF-8 is preserved byte for byte.
+  const std::string overlong = "\xC0\x80";
+  EXPECT_EQ(Glyph(overlong).str(), overlong);
+}
+
+TEST(GlyphTest, Width) {
+  EXPECT_EQ(Glyph().width(), 1);
+  EXPECT_EQ(Glyph("").width(), 0);
+  EXPECT_EQ(Glyph("a").width(), 1);
+  EXPECT_EQ(Glyph("─").width(), 1);
+  EXPECT_EQ(Glyph("测").width(), 2);
+  EXPECT_EQ(Glyph("🎉").width(), 2);
+  EXPECT_EQ(Glyph("a⃦").width(), 1);
+  EXPECT_EQ(Glyph::FromCodepoint(0x2800).width(), 1);
+  EXPECT_EQ(Glyph::FromCodepoint(0x6D4B).width(), 2);
+
+  // The width doesn't leak into the other properties.
+  EXPECT_EQ(Glyph("测").codepoint(), 0x6D4Bu);
+  EXPECT_EQ(Glyph("测").str(), "测");
+  EXPECT_EQ(Glyph("测"), Glyph::FromCodepoint(0x6D4B));
+}
+
+TEST(GlyphTest, Compact) {
+  EXPECT_EQ(sizeof(Glyph), 4u);
+  EXPECT_LE(sizeof(Pixel), 16u);
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
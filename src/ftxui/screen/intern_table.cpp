@@ -0,0 +1,64 @@
+#include "ftxui/screen/intern_table.hpp"
+
+#include <mutex>  // for lock_guard
+
+namespace ftxui {
+
+InternTable::InternTable(size_t max_entries, size_t max_bytes)
+    : max_entries_(max_entries),
+      max_bytes_(max_bytes),
+      chunks_(std::make_unique<std::atomic<std::string*>[]>(
+          (max_entries + kChunkSize - 1) / kChunkSize)) {}
+
+InternTable::~InternTable() {
+  const size_t chunks = (size_ + kChunkSize - 1) / kChunkSize;
+  for (size_t i = 0; i < chunks; ++i) {
+    delete[] chunks_[i].load();
+  }
+}
+
+uint32_t InternTable::Intern(std::string_view str) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(str);
+  if (it != index_.end()) {
+    return it->second;
+  }
+
+  const size_t id = size_.load(std::memory_order_relaxed);
+  if (id >= max_entries_ || bytes_ + str.size() > max_bytes_) {
+    return kNotFound;
+  }
+
+  std::string* chunk = chunks_[id / kChunkSize].load(std::memory_order_relaxed);
+  if (!chunk) {
+    chunk = new std::string[kChunkSize];  // NOLINT
+    chunks_[id / kChunkSize].store(chunk, std::memory_order_release);
+  }
+  std::string& entry = chunk[id % kChunkSize];
+  entry = str;
+  bytes_ += str.size();
+  index_.emplace(entry, uint32_t(id));
+  size_.store(id + 1, std::memory_order_release);
+  return uint32_t(id);
+}
+
+uint32_t InternTable::Find(std::string_view str) const {
+  auto it = index_.find(str);
+  return it == index_.end() ? kNotFound : it->second;
+}
+
+std::string_view InternTable::Get(uint32_t id) const {
+  const std::string* chunk =
+      chunks_[id / kChunkSize].load(std::memory_order_acquire);
+  return chunk[id % kChunkSize];
+}
+
+size_t InternTable::size() const {
+  return size_.load(std::memory_order_acquire);
+}
+
+}  // namespace ftxui
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
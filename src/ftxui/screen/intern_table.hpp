@@ -0,0 +1,64 @@
+#ifndef FTXUI_SCREEN_INTERN_TABLE_HPP
+#define FTXUI_SCREEN_INTERN_TABLE_HPP
+
+#include <atomic>         // for atomic
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint32_t
+#include <memory>         // for unique_ptr
+#include <mutex>          // for mutex
+#include <string>         // for string
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+
+namespace ftxui {
+
+// A bounded set of strings, each identified by a small integer id.
+//
+// Entries are never moved nor removed: an id, and the string_view returned by
+// Get(), remain valid as long as the table. Get() doesn't lock. Intern() does,
+// and fails once |max_entries| entries or |max_bytes| bytes are stored.
+class InternTable {
+ public:
+  static constexpr uint32_t kNotFound = 0xFFFF'FFFF;
+
+  InternTable(size_t max_entries, size_t max_bytes);
+  ~InternTable();
+  InternTable(const InternTable&) = delete;
+  InternTable& operator=(const InternTable&) = delete;
+
+  // Return the id of |str|, adding it when needed. Return |kNotFound| when the
+  // table is full.
+  uint32_t Intern(std::string_view str);
+
+  // Return the id of |str|, or |kNotFound|. This doesn't lock. It must not run
+  // concurrently with Intern(): use it on tables filled once.
+  uint32_t Find(std::string_view str) const;
+
+  // Return the string of |id|, as returned by Intern(). This doesn't lock.
+  std::string_view Get(uint32_t id) const;
+
+  size_t size() const;
+
+ private:
+  static constexpr size_t kChunkSize = 256;
+
+  const size_t max_entries_;
+  const size_t max_bytes_;
+
+  // The strings, allocated by chunks of |kChunkSize|, so that Get() can find
+  // them without touching any structure Intern() may reallocate.
+  std::unique_ptr<std::atomic<std::string*>[]> chunks_;
+  std::atomic<size_t> size_ = 0;
+
+  std::mutex mutex_;
+  size_t bytes_ = 0;
+  std::unordered_map<std::string_view, uint32_t> index_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_SCREEN_INTERN_TABLE_HPP
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <string>  // for string, to_string
+
+#include "ftxui/screen/intern_table.hpp"
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(InternTableTest, Basic) {
+  InternTable table(16, 1024);
+  const uint32_t a = table.Intern("a⃦");
+  const uint32_t b = table.Intern("👨‍👩‍👧");
+  EXPECT_NE(a, b);
+  EXPECT_EQ(table.Intern("a⃦"), a);
+  EXPECT_EQ(table.Get(a), "a⃦");
+  EXPECT_EQ(table.Get(b), "👨‍👩‍👧");
+  EXPECT_EQ(table.Find("a⃦"), a);
+  EXPECT_EQ(table.Find("b"), InternTable::kNotFound);
+  EXPECT_EQ(table.size(), 2u);
+}
+
+TEST(InternTableTest, StableAcrossChunks) {
+  InternTable table(1000, 1 << 20);
+  const std::string_view first = table.Get(table.Intern("0"));
+  for (int i = 1; i < 1000; ++i) {
+    table.Intern(std::to_string(i));
+  }
+  EXPECT_EQ(first, "0");
+  EXPECT_EQ(table.Get(table.Intern("999")), "999");
+  EXPECT_EQ(table.Get(table.Intern("300")), "300");
+}
+
+TEST(InternTableTest, MaxEntries) {
+  InternTable table(2, 1024);
+  EXPECT_NE(table.Intern("a"), InternTable::kNotFound);
+  EXPECT_NE(table.Intern("b"), InternTable::kNotFound);
+  EXPECT_EQ(table.Intern("c"), InternTable::kNotFound);
+  // Existing entries are still found.
+  EXPECT_NE(table.Intern("a"), InternTable::kNotFound);
+  EXPECT_EQ(table.size(), 2u);
+}
+
+TEST(InternTableTest, MaxBytes) {
+  InternTable table(16, 4);
+  EXPECT_NE(table.Intern("abc"), InternTable::kNotFound);
+  EXPECT_EQ(table.Intern("de"), InternTable::kNotFound);
+  EXPECT_NE(table.Intern("d"), InternTable::kNotFound);
+  EXPECT_EQ(table.size(), 2u);
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,13 +1,16 @@
-#include <cstdint>  // for uint8_t
+#include <algorithm>  // for equal, fill, max, min
+#include <cstdint>    // for uint8_t
+#include <cstdlib>    // for abs
 #include <iostream>  // for operator<<, stringstream, basic_ostream, flush, cout, ostream
-#include <map>      // for _Rb_tree_const_iterator, map, operator!=, operator==
 #include <memory>   // for allocator
 #include <sstream>  // IWYU pragma: keep
 #include <utility>  // for pair
+#include <vector>   // for vector
 
 #include "ftxui/screen/screen.hpp"
-#include "ftxui/screen/string.hpp"    // for string_width
+#include "ftxui/screen/glyph.hpp"     // for Glyph
 #include "ftxui/screen/terminal.hpp"  // for Dimensions, Size
+#include "ftxui/screen/util.hpp"      // for AppendDecimal
 
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
@@ -49,17 +52,17 @@ void WindowsEmulateVT100Terminal() {
 }
 #endif
 
+// Append the SGR parameters turning the |previous| style into the |next| one.
+// Every parameter is followed by ';'. Return whether some attributes are turned
+// off. Otherwise, there are no shorter ways to update the style.
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
-void UpdatePixelStyle(std::stringstream& ss,
-                      Pixel& previous,
-                      const Pixel& next) {
-  if (next == previous) {
-    return;
-  }
+bool AppendStyleUpdate(std::string& out, Pixel previous, const Pixel& next) {
+  bool turn_off = false;
 
   if ((!next.bold && previous.bold) ||  //
       (!next.dim && previous.dim)) {
-    ss << "\x1B[22m";  // BOLD_RESET and DIM_RESET
+    out += "22;";  // BOLD_RESET and DIM_RESET
+    turn_off = true;
     // We might have wrongfully reset dim or bold because they share the same
     // resetter. Take it into account so that the side effect will cause it to
     // be set again below.
@@ -72,58 +75,109 @@ void UpdatePixelStyle(std::stringstream& ss,
     // We might have wrongfully reset underlined or underlinedbold because they
     // share the same resetter. Take it into account so that the side effect
     // will cause it to be set again below.
-    ss << "\x1B[24m";  // UNDERLINED_RESET
+    out += "24;";  // UNDERLINED_RESET
+    turn_off = true;
     previous.underlined = false;
     previous.underlined_double = false;
   }
 
   if (next.bold && !previous.bold) {
-    ss << "\x1B[1m";  // BOLD_SET
+    out += "1;";  // BOLD_SET
   }
 
   if (next.dim && !previous.dim) {
-    ss << "\x1B[2m";  // DIM_SET
+    out += "2;";  // DIM_SET
   }
 
   if (next.underlined && !previous.underlined) {
-    ss << "\x1B[4m";  // UNDERLINED_SET
+    out += "4;";  // UNDERLINED_SET
   }
 
   if (next.blink && !previous.blink) {
-    ss << "\x1B[5m";  // BLINK_SET
+    out += "5;";  // BLINK_SET
   }
 
   if (!next.blink && previous.blink) {
-    ss << "\x1B[25m";  // BLINK_RESET
+    out += "25;";  // BLINK_RESET
+    turn_off = true;
   }
 
   if (next.inverted && !previous.inverted) {
-    ss << "\x1B[7m";  // INVERTED_SET
+    out += "7;";  // INVERTED_SET
   }
 
   if (!next.inverted && previous.inverted) {
-    ss << "\x1B[27m";  // INVERTED_RESET
+    out += "27;";  // INVERTED_RESET
+    turn_off = true;
   }
 
   if (next.strikethrough && !previous.strikethrough) {
-    ss << "\x1B[9m";  // CROSSED_OUT
+    out += "9;";  // CROSSED_OUT
   }
 
   if (!next.strikethrough && previous.strikethrough) {
-    ss << "\x1B[29m";  // CROSSED_OUT_RESET
+    out += "29;";  // CROSSED_OUT_RESET
+    turn_off = true;
   }
 
   if (next.underlined_double && !previous.underlined_double) {
-    ss << "\x1B[21m";  // DOUBLE_UNDERLINED_SET
+    out += "21;";  // DOUBLE_UNDERLINED_SET
+  }
+
+  if (next.foreground_color != previous.foreground_color) {
+    next.foreground_color.AppendTo(out, false);
+    out += ';';
+    turn_off |= next.foreground_color == Color();
+  }
+
+  if (next.background_color != previous.background_color) {
+    next.background_color.AppendTo(out, true);
+    out += ';';
+    turn_off |= next.background_color == Color();
   }
 
-  if (next.foreground_color != previous.foreground_color ||
-      next.background_color != previous.background_color) {
-    ss << "\x1B[" + next.foreground_color.Print(false) + "m";
-    ss << "\x1B[" + next.background_color.Print(true) + "m";
+  return turn_off;
+}
+
+// Append the SGR parameters resetting every attributes, and setting the ones
+// of |next|. Every parameter is followed by ';'.
+void AppendStyleReset(std::string& out, const Pixel& next) {
+  out += "0;";  // RESET
+  AppendStyleUpdate(out, Pixel(), next);
+}
+
+// Emit a single SGR sequence turning the |previous| style into the |next| one.
+// The shortest of the incremental update and the "reset+set" forms is used.
+void UpdatePixelStyle(std::string& out, Pixel& previous, const Pixel& next) {
+  if (next == previous) {
+    return;
   }
 
+  out += "\x1B[";
+  const size_t begin = out.size();
+  const bool turn_off = AppendStyleUpdate(out, previous, next);
+  const size_t update_size = out.size() - begin;
   previous = next;
+
+  // Nothing changed, besides the character.
+  if (update_size == 0) {
+    out.resize(begin - 2);
+    return;
+  }
+
+  // Resetting first can only be shorter when some attributes are turned off.
+  // Write both forms one after the other, and drop the longest. This doesn't
+  // allocate once |out| is large enough.
+  if (turn_off) {
+    AppendStyleReset(out, next);
+    const size_t reset_size = out.size() - begin - update_size;
+    if (reset_size < update_size) {
+      out.erase(begin, update_size);
+    } else {
+      out.resize(begin + update_size);
+    }
+  }
+  out.back() = 'm';
 }
 
 struct TileEncoding {
@@ -133,25 +187,22 @@ struct TileEncoding {
   uint8_t down : 2;
   uint8_t round : 1;
 
-  // clang-format off
-  bool operator<(const TileEncoding& other) const {
-    if (left < other.left)   { return  true;  }
-    if (left > other.left)   { return  false; }
-    if (top < other.top)     { return  true;  }
-    if (top > other.top)     { return  false; }
-    if (right < other.right) { return  true;  }
-    if (right > other.right) { return  false; }
-    if (down < other.down)   { return  true;  }
-    if (down > other.down)   { return  false; }
-    if (round < other.round) { return  true;  }
-    if (round > other.round) { return  false; }
-      return false;
-  }
-  // clang-format on
+  // Every box drawing character has at least one branch.
+  constexpr bool valid() const { return left || top || right || down; }
+
+  // A unique index, in [0, 512).
+  constexpr int index() const {
+    return left | top << 2 | right << 4 | down << 6 | round << 8;  // NOLINT
+  }
+};
+
+struct TileEntry {
+  const char* glyph;
+  TileEncoding encoding;
 };
 
 // clang-format off
-const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
+constexpr TileEntry tile_entries[] = { // NOLINT
     {"─", {1, 0, 1, 0, 0}},
     {"━", {2, 0, 2, 0, 0}},
     {"╍", {2, 0, 2, 0, 0}},
@@ -294,78 +345,228 @@ const std::map<std::string, TileEncoding> tile_encoding = { // NOLINT
 };
 // clang-format on
 
-template <class A, class B>
-std::map<B, A> InvertMap(const std::map<A, B> input) {
-  std::map<B, A> output;
-  for (const auto& it : input) {
-    output[it.second] = it.first;
+// Every box drawing character belongs to the U+2500-U+257F block.
+constexpr uint32_t tile_first = 0x2500;
+constexpr uint32_t tile_count = 0x80;
+
+// Decode the 3 bytes UTF-8 representation of a box drawing character.
+constexpr uint32_t TileCodepoint(const char* glyph) {
+  return uint32_t(uint8_t(glyph[0]) & 0x0F) << 12 |  // NOLINT
+         uint32_t(uint8_t(glyph[1]) & 0x3F) << 6 |   // NOLINT
+         uint32_t(uint8_t(glyph[2]) & 0x3F);         // NOLINT
+}
+
+struct TileTables {
+  // Indexed by the codepoint offset in the block. Invalid when absent.
+  TileEncoding encoding[tile_count];  // NOLINT
+  // Indexed by TileEncoding::index(). Contains the codepoint offset + 1, or 0
+  // when absent. When several characters share an encoding, the last wins.
+  uint8_t glyph[512];  // NOLINT
+};
+
+constexpr TileTables BuildTileTables() {
+  TileTables tables{};
+  for (const TileEntry& entry : tile_entries) {
+    const uint32_t offset = TileCodepoint(entry.glyph) - tile_first;
+    tables.encoding[offset] = entry.encoding;
+    tables.glyph[entry.encoding.index()] = uint8_t(offset + 1);
   }
-  return output;
+  return tables;
 }
 
-const std::map<TileEncoding, std::string> tile_encoding_inverse =  // NOLINT
-    InvertMap(tile_encoding);
+constexpr TileTables tile_tables = BuildTileTables();
 
-void UpgradeLeftRight(std::string& left, std::string& right) {
-  const auto it_left = tile_encoding.find(left);
-  if (it_left == tile_encoding.end()) {
+TileEncoding GetTileEncoding(const Glyph& glyph) {
+  const uint32_t offset = glyph.codepoint() - tile_first;
+  if (offset >= tile_count) {
+    return {};
+  }
+  return tile_tables.encoding[offset];  // NOLINT
+}
+
+// Replace |glyph| by the box drawing character matching |encoding|, if any.
+void SetTileEncoding(Glyph& glyph, TileEncoding encoding) {
+  const uint8_t offset = tile_tables.glyph[encoding.index()];  // NOLINT
+  if (offset != 0) {
+    glyph = Glyph::FromCodepoint(tile_first + offset - 1);
+  }
+}
+
+void UpgradeLeftRight(Glyph& left, Glyph& right) {
+  const TileEncoding encoding_left = GetTileEncoding(left);
+  if (!encoding_left.valid()) {
     return;
   }
-  const auto it_right = tile_encoding.find(right);
-  if (it_right == tile_encoding.end()) {
+  const TileEncoding encoding_right = GetTileEncoding(right);
+  if (!encoding_right.valid()) {
     return;
   }
 
-  if (it_left->second.right == 0 && it_right->second.left != 0) {
-    TileEncoding encoding_left = it_left->second;
-    encoding_left.right = it_right->second.left;
-    const auto it_left_upgrade = tile_encoding_inverse.find(encoding_left);
-    if (it_left_upgrade != tile_encoding_inverse.end()) {
-      left = it_left_upgrade->second;
-    }
+  if (encoding_left.right == 0 && encoding_right.left != 0) {
+    TileEncoding upgrade = encoding_left;
+    upgrade.right = encoding_right.left;
+    SetTileEncoding(left, upgrade);
   }
 
-  if (it_right->second.left == 0 && it_left->second.right != 0) {
-    TileEncoding encoding_right = it_right->second;
-    encoding_right.left = it_left->second.right;
-    const auto it_right_upgrade = tile_encoding_inverse.find(encoding_right);
-    if (it_right_upgrade != tile_encoding_inverse.end()) {
-      right = it_right_upgrade->second;
-    }
+  if (encoding_right.left == 0 && encoding_left.right != 0) {
+    TileEncoding upgrade = encoding_right;
+    upgrade.left = encoding_left.right;
+    SetTileEncoding(right, upgrade);
   }
 }
 
-void UpgradeTopDown(std::string& top, std::string& down) {
-  const auto it_top = tile_encoding.find(top);
-  if (it_top == tile_encoding.end()) {
+void UpgradeTopDown(Glyph& top, Glyph& down) {
+  const TileEncoding encoding_top = GetTileEncoding(top);
+  if (!encoding_top.valid()) {
     return;
   }
-  const auto it_down = tile_encoding.find(down);
-  if (it_down == tile_encoding.end()) {
+  const TileEncoding encoding_down = GetTileEncoding(down);
+  if (!encoding_down.valid()) {
     return;
   }
 
-  if (it_top->second.down == 0 && it_down->second.top != 0) {
-    TileEncoding encoding_top = it_top->second;
-    encoding_top.down = it_down->second.top;
-    const auto it_top_down = tile_encoding_inverse.find(encoding_top);
-    if (it_top_down != tile_encoding_inverse.end()) {
-      top = it_top_down->second;
-    }
+  if (encoding_top.down == 0 && encoding_down.top != 0) {
+    TileEncoding upgrade = encoding_top;
+    upgrade.down = encoding_down.top;
+    SetTileEncoding(top, upgrade);
   }
 
-  if (it_down->second.top == 0 && it_top->second.down != 0) {
-    TileEncoding encoding_down = it_down->second;
-    encoding_down.top = it_top->second.down;
-    const auto it_down_top = tile_encoding_inverse.find(encoding_down);
-    if (it_down_top != tile_encoding_inverse.end()) {
-      down = it_down_top->second;
-    }
+  if (encoding_down.top == 0 && encoding_top.down != 0) {
+    TileEncoding upgrade = encoding_down;
+    upgrade.top = encoding_top.down;
+    SetTileEncoding(down, upgrade);
   }
 }
 
 bool ShouldAttemptAutoMerge(Pixel& pixel) {
-  return pixel.automerge && pixel.character.size() == 3;
+  return pixel.automerge;
+}
+
+bool IsFullWidth(const Pixel& pixel) {
+  return pixel.character.width() == 2;
+}
+
+bool SameLine(const Screen& a, int a_y, const Screen& b, int b_y) {
+  const Pixel* a_line = a.LineAt(a_y);
+  return std::equal(a_line, a_line + a.dimx(), b.LineAt(b_y));
+}
+
+// Equal lines have equal hashes.
+uint64_t HashLine(const Screen& screen, int y) {
+  uint64_t hash = 0xCBF2'9CE4'8422'2325;  // NOLINT: FNV-1a offset basis.
+  auto mix = [&](uint64_t value) {
+    hash = (hash ^ value) * 0x0000'0100'0000'01B3;  // NOLINT: FNV-1a prime.
+  };
+  const Pixel* line = screen.LineAt(y);
+  for (int x = 0; x < screen.dimx(); ++x) {
+    const Pixel& pixel = line[x];
+    // NOLINTBEGIN
+    const uint64_t style = pixel.blink << 0 | pixel.bold << 1 |
+                           pixel.dim << 2 | pixel.inverted << 3 |
+                           pixel.underlined << 4 |
+                           pixel.underlined_double << 5 |
+                           pixel.strikethrough << 6 | pixel.automerge << 7;
+    mix(uint64_t(pixel.character.hash()) << 8 | style);
+    mix(uint64_t(pixel.background_color.hash()) << 32 |
+        pixel.foreground_color.hash());
+    // NOLINTEND
+  }
+  return hash;
+}
+
+// The lines |top| to |bottom| moved vertically: the line |y| of the next frame
+// is the line |y + shift| of the previous one.
+struct Scroll {
+  int top = 0;
+  int bottom = -1;
+  int shift = 0;
+};
+
+// Find the vertical shift of the modified lines that keeps the most of them.
+// This is meant for scrolling content, like logs.
+//
+// Every line is hashed once. The shifts are compared using the hashes only.
+// Pixels are compared to confirm equal hashes, once per line and for the
+// chosen shift only.
+Scroll DetectScroll(const Screen& previous, const Screen& next) {
+  Scroll scroll;
+
+  // Reused from one frame to the next, to avoid allocating.
+  thread_local std::vector<uint64_t> previous_hashes;
+  thread_local std::vector<uint64_t> next_hashes;
+  previous_hashes.resize(next.dimy());
+  next_hashes.resize(next.dimy());
+  for (int y = 0; y < next.dimy(); ++y) {
+    previous_hashes[y] = HashLine(previous, y);
+    next_hashes[y] = HashLine(next, y);
+  }
+  auto same_line = [&](int y, int previous_y) {
+    return next_hashes[y] == previous_hashes[previous_y] &&
+           SameLine(next, y, previous, previous_y);
+  };
+
+  int top = 0;
+  int bottom = next.dimy() - 1;
+  while (top <= bottom && same_line(top, top)) {
+    ++top;
+  }
+  while (top <= bottom && same_line(bottom, bottom)) {
+    --bottom;
+  }
+
+  // Scrolling costs about as many bytes as drawing a short line. It is only
+  // worth it when at least two more lines can be kept.
+  const int min_gain = 2;
+  const int height = bottom - top + 1;
+  if (height <= min_gain) {
+    return scroll;
+  }
+
+  int unchanged = 0;
+  for (int y = top; y <= bottom; ++y) {
+    unchanged += same_line(y, y);
+  }
+
+  // The number of lines kept by |shift|. When |exact| is false, lines with
+  // equal hashes are assumed to be equal.
+  auto kept = [&](int shift, bool exact) {
+    int count = 0;
+    const int y_min = std::max(top, top - shift);
+    const int y_max = std::min(bottom, bottom - shift);
+    for (int y = y_min; y <= y_max; ++y) {
+      count += exact ? same_line(y, y + shift)
+                     : next_hashes[y] == previous_hashes[y + shift];
+    }
+    return count;
+  };
+
+  int best_gain = min_gain - 1;
+  int best_shift = 0;
+  for (int shift = 1 - height; shift < height; ++shift) {
+    if (shift == 0) {
+      continue;
+    }
+    const int gain = kept(shift, /*exact=*/false) - unchanged;
+    if (gain > best_gain) {
+      best_gain = gain;
+      best_shift = shift;
+    }
+  }
+
+  if (best_shift != 0 &&
+      kept(best_shift, /*exact=*/true) - unchanged >= min_gain) {
+    scroll = {top, bottom, best_shift};
+  }
+  return scroll;
+}
+
+// Move the cursor to an absolute position (CUP). Coordinates are 0-based.
+void MoveCursorTo(std::string& out, int x, int y) {
+  out += "\x1B[";
+  util::AppendDecimal(out, y + 1);
+  out += ';';
+  util::AppendDecimal(out, x + 1);
+  out += 'H';
 }
 
 }  // namespace
@@ -379,6 +580,8 @@ bool Pixel::operator==(const Pixel& other) const {
          dim == other.dim &&                            //
          inverted == other.inverted &&                  //
          underlined == other.underlined &&              //
+         underlined_double == other.underlined_double &&  //
+         strikethrough == other.strikethrough &&        //
          automerge == other.automerge;                  //
 }
 
@@ -412,7 +615,7 @@ Screen::Screen(int dimx, int dimy)
     : stencil{0, dimx - 1, 0, dimy - 1},
       dimx_(dimx),
       dimy_(dimy),
-      pixels_(dimy, std::vector<Pixel>(dimx)) {
+      pixels_(dimx * dimy) {
 #if defined(_WIN32)
   // The placement of this call is a bit weird, however we can assume that
   // anybody who instantiates a Screen object eventually wants to output
@@ -428,47 +631,188 @@ Screen::Screen(int dimx, int dimy)
 /// Produce a std::string that can be used to print the Screen on the terminal.
 /// Don't forget to flush stdout. Alternatively, you can use Screen::Print();
 std::string Screen::ToString() {
-  std::stringstream ss;
+  std::string out;
+  Encode(out);
+  return out;
+}
 
+/// Same as ToString(), but append the output to |out|. Reusing the same buffer
+/// from one frame to the next avoids any allocation.
+void Screen::Encode(std::string& out) const {
   Pixel previous_pixel;
   const Pixel final_pixel;
 
   for (int y = 0; y < dimy_; ++y) {
     if (y != 0) {
-      UpdatePixelStyle(ss, previous_pixel, final_pixel);
-      ss << "\r\n";
+      UpdatePixelStyle(out, previous_pixel, final_pixel);
+      out += "\r\n";
     }
     bool previous_fullwidth = false;
-    for (const auto& pixel : pixels_[y]) {
+    const Pixel* line = LineAt(y);
+    for (int x = 0; x < dimx_; ++x) {
+      const Pixel& pixel = line[x];
       if (!previous_fullwidth) {
-        UpdatePixelStyle(ss, previous_pixel, pixel);
-        ss << pixel.character;
+        UpdatePixelStyle(out, previous_pixel, pixel);
+        pixel.character.AppendTo(out);
       }
-      previous_fullwidth = (string_width(pixel.character) == 2);
+      previous_fullwidth = IsFullWidth(pixel);
     }
   }
 
-  UpdatePixelStyle(ss, previous_pixel, final_pixel);
+  UpdatePixelStyle(out, previous_pixel, final_pixel);
+}
 
-  return ss.str();
+/// Produce a std::string updating a terminal currently displaying |previous|
+/// so that it displays this Screen instead. Only the cells that changed are
+/// emitted, using absolute cursor positioning. The result is empty when both
+/// screens are identical.
+///
+/// When lines moved vertically, like in a scrolling log, they are moved using
+/// the terminal scroll region (DECSTBM + SU/SD) instead of being drawn again.
+///
+/// Both screens must have the same dimensions, and be drawn from the top left
+/// corner of the terminal, like in the alternate screen.
+std::string Screen::ToDiffString(const Screen& previous) const {
+  std::string out;
+  EncodeDiff(previous, out);
+  return out;
+}
+
+/// Same as ToDiffString(), but append the output to |out|. Reusing the same
+/// buffer from one frame to the next avoids any allocation.
+void Screen::EncodeDiff(const Screen& previous, std::string& out) const {
+  Pixel previous_pixel;
+  const Pixel final_pixel;
+
+  // Move the lines already displayed by the terminal, instead of drawing them
+  // again.
+  const Scroll scroll = DetectScroll(previous, *this);
+  if (scroll.shift != 0) {
+    out += "\x1B[";  // DECSTBM: Set the scroll region.
+    util::AppendDecimal(out, scroll.top + 1);
+    out += ';';
+    util::AppendDecimal(out, scroll.bottom + 1);
+    out += "r\x1B[";
+    util::AppendDecimal(out, std::abs(scroll.shift));
+    out += scroll.shift > 0 ? 'S' : 'T';  // SU: Scroll up, SD: Scroll down.
+    out += "\x1B[r";                      // Reset the scroll region.
+  }
+
+  // Printing a few unchanged cells is cheaper than moving the cursor over
+  // them.
+  const int max_gap = 4;
+
+  // The lines exposed by the scroll are blank.
+  const Pixel blank;
+
+  for (int y = 0; y < dimy_; ++y) {
+    const Pixel* next_line = LineAt(y);
+    const Pixel* previous_line = previous.LineAt(y);
+    if (scroll.top <= y && y <= scroll.bottom) {
+      const int previous_y = y + scroll.shift;
+      previous_line = (scroll.top <= previous_y && previous_y <= scroll.bottom)
+                          ? previous.LineAt(previous_y)
+                          : nullptr;
+    }
+    auto previous_at = [&](int x) -> const Pixel& {
+      return previous_line ? previous_line[x] : blank;
+    };
+
+    int x = 0;
+    while (x < dimx_) {
+      if (next_line[x] == previous_at(x)) {
+        ++x;
+        continue;
+      }
+
+      // A fullwidth character on the left overlaps the modified cell. It has
+      // to be drawn again.
+      int begin = x;
+      if (begin > 0 && (IsFullWidth(next_line[begin - 1]) ||
+                        IsFullWidth(previous_at(begin - 1)))) {
+        --begin;
+      }
+      if (begin > 0 && IsFullWidth(next_line[begin - 1])) {
+        --begin;
+      }
+
+      int end = x + 1;
+      for (int i = end, gap = 0; i < dimx_ && gap < max_gap; ++i) {
+        if (next_line[i] == previous_at(i)) {
+          ++gap;
+          continue;
+        }
+        end = i + 1;
+        gap = 0;
+      }
+      if (end < dimx_ && (IsFullWidth(next_line[end - 1]) ||
+                          IsFullWidth(previous_at(end - 1)))) {
+        ++end;
+      }
+
+      MoveCursorTo(out, begin, y);
+      bool previous_fullwidth = false;
+      for (int i = begin; i < end; ++i) {
+        const Pixel& pixel = next_line[i];
+        if (!previous_fullwidth) {
+          UpdatePixelStyle(out, previous_pixel, pixel);
+          pixel.character.AppendTo(out);
+        }
+        previous_fullwidth = IsFullWidth(pixel);
+      }
+      x = end;
+    }
+  }
+
+  UpdatePixelStyle(out, previous_pixel, final_pixel);
 }
 
 void Screen::Print() {
-  std::cout << ToString() << '\0' << std::flush;
+  std::string out;
+  Encode(out);
+  std::cout << out << '\0' << std::flush;
 }
 
-/// @brief Access a character a given position.
+/// @brief Access a character a given position. The returned Glyph can be
+/// assigned and compared like a std::string.
 /// @param x The character position along the x-axis.
 /// @param y The character position along the y-axis.
-std::string& Screen::at(int x, int y) {
-  return PixelAt(x, y).character;
+Glyph& Screen::at(int x, int y) {
+  return PixelAtRegistered(x, y).character;
 }
 
 /// @brief Access a Pixel at a given position.
+/// Its Pixel::automerge can be set, ApplyShader() then visits every cell.
 /// @param x The pixel position along the x-axis.
 /// @param y The pixel position along the y-axis.
 Pixel& Screen::PixelAt(int x, int y) {
-  return stencil.Contain(x, y) ? pixels_[y][x] : dev_null_pixel();
+  automerge_unregistered_ = true;
+  return PixelAtRegistered(x, y);
+}
+
+/// @brief Access a Pixel at a given position.
+/// The caller must register with RegisterAutomerge() the cells where it sets
+/// Pixel::automerge. This lets ApplyShader() visit only those.
+/// @param x The pixel position along the x-axis.
+/// @param y The pixel position along the y-axis.
+Pixel& Screen::PixelAtRegistered(int x, int y) {
+  return stencil.Contain(x, y) ? pixels_[y * dimx_ + x] : dev_null_pixel();
+}
+
+/// @brief Access the pixels of a line. They are stored contiguously, from left
+/// to right.
+/// @param y The line position along the y-axis.
+/// @return A pointer to the dimx() pixels of the line.
+Pixel* Screen::LineAt(int y) {
+  return pixels_.data() + y * dimx_;
+}
+
+/// @brief Access the pixels of a line. They are stored contiguously, from left
+/// to right.
+/// @param y The line position along the y-axis.
+/// @return A pointer to the dimx() pixels of the line.
+const Pixel* Screen::LineAt(int y) const {
+  return pixels_.data() + y * dimx_;
 }
 
 /// @brief Return a string to be printed in order to reset the cursor position
@@ -508,46 +852,70 @@ std::string Screen::ResetPosition(bool clear) const {
   return ss.str();
 }
 
+/// @brief Change the dimensions of the screen. The previously allocated memory
+/// is reused when possible. The pixels are cleared.
+void Screen::Resize(int dimx, int dimy) {
+  dimx_ = dimx;
+  dimy_ = dimy;
+  pixels_.assign(dimx * dimy, Pixel());
+  automerge_boxes_.clear();
+  automerge_unregistered_ = false;
+  cursor_.x = dimx_ - 1;
+  cursor_.y = dimy_ - 1;
+}
+
 /// @brief Clear all the pixel from the screen.
 void Screen::Clear() {
-  for (auto& line : pixels_) {
-    for (auto& cell : line) {
-      cell = Pixel();
-    }
-  }
+  std::fill(pixels_.begin(), pixels_.end(), Pixel());
+  automerge_boxes_.clear();
+  automerge_unregistered_ = false;
   cursor_.x = dimx_ - 1;
   cursor_.y = dimy_ - 1;
 }
 
-// clang-format off
+/// @brief Register the cells of |box| as potentially using
+/// Pixel::automerge. ApplyShader() only visits the registered cells, unless
+/// PixelAt() was used.
+void Screen::RegisterAutomerge(const Box& box) {
+  automerge_boxes_.push_back(box);
+}
+
 void Screen::ApplyShader() {
   // Merge box characters togethers.
-  for (int y = 0; y < dimy_; ++y) {
-    for (int x = 0; x < dimx_; ++x) {
-      // Box drawing character uses exactly 3 byte.
-      Pixel& cur = pixels_[y][x];
-      if (!ShouldAttemptAutoMerge(cur)) {
-        continue;
-      }
+  const Box screen_box = {0, dimx_ - 1, 0, dimy_ - 1};
+  if (automerge_unregistered_) {
+    // The cells using automerge are unknown. Visit all of them.
+    automerge_boxes_.assign(1, screen_box);
+  }
+  for (const Box& automerge_box : automerge_boxes_) {
+    const Box box = Box::Intersection(automerge_box, screen_box);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      Pixel* line = LineAt(y);
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        Pixel& cur = line[x];
+        if (!ShouldAttemptAutoMerge(cur)) {
+          continue;
+        }
 
-      if (x > 0) {
-        Pixel& left = pixels_[y][x-1];
-        if (ShouldAttemptAutoMerge(left)) {
-          UpgradeLeftRight(left.character, cur.character);
+        if (x > 0) {
+          Pixel& left = line[x - 1];
+          if (ShouldAttemptAutoMerge(left)) {
+            UpgradeLeftRight(left.character, cur.character);
+          }
         }
-      }
-      if (y > 0) {
-        Pixel& top = pixels_[y-1][x];
-        if (ShouldAttemptAutoMerge(top)) {
-          UpgradeTopDown(top.character, cur.character);
+        if (y > 0) {
+          Pixel& top = line[x - dimx_];
+          if (ShouldAttemptAutoMerge(top)) {
+            UpgradeTopDown(top.character, cur.character);
+          }
         }
       }
     }
   }
+  automerge_boxes_.clear();
+  automerge_unregistered_ = false;
 }
 
-// clang-format on
-
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+#include <string>  // for allocator, string
+
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(ScreenTest, LineAt) {
+  Screen screen(3, 2);
+  screen.at(0, 1) = "a";
+  screen.at(2, 1) = "b";
+  const Pixel* line = screen.LineAt(1);
+  EXPECT_EQ(line[0].character, "a");
+  EXPECT_EQ(line[2].character, "b");
+  EXPECT_EQ(&line[2], &screen.PixelAt(2, 1));
+  EXPECT_EQ(screen.LineAt(0) + 3, screen.LineAt(1));
+}
+
+TEST(ScreenTest, Encode) {
+  Screen screen(3, 2);
+  screen.at(0, 0) = "a";
+  screen.PixelAt(1, 1).foreground_color = Color::RGB(1, 2, 3);
+  std::string out = "prefix";
+  screen.Encode(out);
+  EXPECT_EQ(out, "prefix" + screen.ToString());
+
+  // The buffer can be reused without reallocating.
+  const size_t capacity = out.capacity();
+  out.clear();
+  screen.Encode(out);
+  EXPECT_EQ(out, screen.ToString());
+  EXPECT_EQ(out.capacity(), capacity);
+}
+
+TEST(ScreenTest, StyleSingleSequence) {
+  Screen screen(2, 1);
+  screen.at(0, 0) = "a";
+  screen.PixelAt(0, 0).bold = true;
+  screen.PixelAt(0, 0).underlined = true;
+  screen.PixelAt(0, 0).foreground_color = Color::Red;
+  EXPECT_EQ(screen.ToString(), "\x1B[1;4;31ma\x1B[0m ");
+}
+
+TEST(ScreenTest, StyleOnlyChangedColor) {
+  Screen screen(2, 1);
+  screen.at(0, 0) = "a";
+  screen.at(1, 0) = "b";
+  screen.PixelAt(0, 0).foreground_color = Color::Red;
+  screen.PixelAt(1, 0).foreground_color = Color::Red;
+  screen.PixelAt(1, 0).background_color = Color::Blue;
+  EXPECT_EQ(screen.ToString(), "\x1B[31ma\x1B[44mb\x1B[0m");
+}
+
+TEST(ScreenTest, StyleIncrementalWhenShorter) {
+  Screen screen(2, 1);
+  screen.PixelAt(0, 0).bold = true;
+  screen.PixelAt(0, 0).inverted = true;
+  screen.PixelAt(0, 0).foreground_color = Color::Red;
+  screen.PixelAt(1, 0).inverted = true;
+  screen.PixelAt(1, 0).foreground_color = Color::Red;
+  // "22" is shorter than "0;7;31".
+  EXPECT_EQ(screen.ToString(), "\x1B[1;7;31m \x1B[22m \x1B[0m");
+}
+
+namespace {
+Screen Cross(bool registered) {
+  Screen screen(3, 3);
+  auto pixel_at = [&](int x, int y) -> Pixel& {
+    return registered ? screen.PixelAtRegistered(x, y) : screen.PixelAt(x, y);
+  };
+  for (int i = 0; i < 3; ++i) {
+    pixel_at(i, 1).character = "─";
+    pixel_at(1, i).character = "│";
+    pixel_at(i, 1).automerge = true;
+    pixel_at(1, i).automerge = true;
+  }
+  return screen;
+}
+}  // namespace
+
+TEST(ScreenTest, AutomergeRegistered) {
+  Screen screen = Cross(/*registered=*/true);
+  screen.RegisterAutomerge({0, 2, 1, 1});
+  screen.RegisterAutomerge({1, 1, 0, 2});
+  screen.ApplyShader();
+  EXPECT_EQ(screen.at(1, 1), "┼");
+  EXPECT_EQ(screen.at(1, 0), "│");
+  EXPECT_EQ(screen.at(0, 1), "─");
+}
+
+TEST(ScreenTest, AutomergeNotRegistered) {
+  Screen screen = Cross(/*registered=*/true);
+  screen.ApplyShader();
+  EXPECT_EQ(screen.at(1, 1), "│");
+}
+
+// The pixels accessed with PixelAt() may use automerge without being
+// registered. The whole screen is merged.
+TEST(ScreenTest, AutomergePixelAt) {
+  Screen screen = Cross(/*registered=*/false);
+  screen.ApplyShader();
+  EXPECT_EQ(screen.at(1, 1), "┼");
+
+  // This applies only until the screen is cleared.
+  screen.Clear();
+  screen.PixelAtRegistered(0, 0).character = "─";
+  screen.PixelAtRegistered(1, 0).character = "│";
+  screen.PixelAtRegistered(0, 0).automerge = true;
+  screen.PixelAtRegistered(1, 0).automerge = true;
+  screen.ApplyShader();
+  EXPECT_EQ(screen.at(1, 0), "│");
+}
+
+TEST(ScreenTest, AutomergeOutOfScreen) {
+  Screen screen = Cross(/*registered=*/true);
+  screen.RegisterAutomerge({-5, 10, -5, 10});
+  screen.ApplyShader();
+  EXPECT_EQ(screen.at(1, 1), "┼");
+}
+
+TEST(ScreenTest, DiffIdentical) {
+  Screen previous(4, 2);
+  Screen next(4, 2);
+  previous.at(1, 1) = "a";
+  next.at(1, 1) = "a";
+  EXPECT_EQ("", next.ToDiffString(previous));
+}
+
+TEST(ScreenTest, DiffSingleCell) {
+  Screen previous(4, 2);
+  Screen next(4, 2);
+  next.at(2, 1) = "a";
+  EXPECT_EQ("\x1B[2;3Ha", next.ToDiffString(previous));
+}
+
+TEST(ScreenTest, DiffMergeSmallGap) {
+  Screen previous(10, 1);
+  Screen next(10, 1);
+  next.at(1, 0) = "a";
+  next.at(3, 0) = "b";
+  EXPECT_EQ("\x1B[1;2Ha b", next.ToDiffString(previous));
+}
+
+TEST(ScreenTest, DiffSplitLargeGap) {
+  Screen previous(10, 1);
+  Screen next(10, 1);
+  next.at(0, 0) = "a";
+  next.at(9, 0) = "b";
+  EXPECT_EQ("\x1B[1;1Ha\x1B[1;10Hb", next.ToDiffString(previous));
+}
+
+TEST(ScreenTest, DiffStyle) {
+  Screen previous(4, 1);
+  Screen next(4, 1);
+  next.PixelAt(1, 0).bold = true;
+  EXPECT_EQ("\x1B[1;2H\x1B[1m \x1B[0m", next.ToDiffString(previous));
+}
+
+TEST(ScreenTest, DiffFullWidth) {
+  Screen previous(4, 1);
+  Screen next(4, 1);
+  previous.at(0, 0) = "测";
+  previous.at(1, 0) = "";
+  next.at(0, 0) = "测";
+  next.at(1, 0) = "";
+  next.at(2, 0) = "a";
+
+  // The modified cell isn't overlapped by the fullwidth character.
+  EXPECT_EQ("\x1B[1;3Ha", next.ToDiffString(previous));
+
+  // Replacing the second half of a fullwidth character redraws it entirely.
+  next.at(1, 0) = "b";
+  next.at(0, 0) = "a";
+  EXPECT_EQ("\x1B[1;1Haba", next.ToDiffString(previous));
+}
+
+namespace {
+Screen Lines(const std::string& lines) {
+  Screen screen(3, int(lines.size()));
+  for (int y = 0; y < int(lines.size()); ++y) {
+    screen.at(0, y) = std::string(1, lines[y]);
+  }
+  return screen;
+}
+}  // namespace
+
+TEST(ScreenTest, DiffScrollUp) {
+  Screen previous = Lines("abcde");
+  Screen next = Lines("bcdef");
+  EXPECT_EQ("\x1B[1;5r\x1B[1S\x1B[r\x1B[5;1Hf", next.ToDiffString(previous));
+}
+
+TEST(ScreenTest, DiffScrollDown) {
+  Screen previous = Lines("abcde");
+  Screen next = Lines("zzabc");
+  EXPECT_EQ("\x1B[1;5r\x1B[2T\x1B[r\x1B[1;1Hz\x1B[2;1Hz",
+            next.ToDiffString(previous));
+}
+
+TEST(ScreenTest, DiffScrollRegion) {
+  Screen previous = Lines("-abcde-");
+  Screen next = Lines("-bcdex-");
+  EXPECT_EQ("\x1B[2;6r\x1B[1S\x1B[r\x1B[6;1Hx", next.ToDiffString(previous));
+}
+
+TEST(ScreenTest, DiffScrollBlankLines) {
+  // Blank lines are all equal. They must not hide the shift of the others.
+  Screen previous = Lines(std::string(100, ' ') + "ab");
+  Screen next = Lines(std::string(99, ' ') + "ab ");
+  EXPECT_EQ("\x1B[100;102r\x1B[1S\x1B[r", next.ToDiffString(previous));
+  EXPECT_EQ("", next.ToDiffString(next));
+}
+
+TEST(ScreenTest, DiffNoScrollWhenNotWorth) {
+  Screen previous = Lines("abcd");
+  Screen next = Lines("bxyz");
+  EXPECT_EQ("\x1B[1;1Hb\x1B[2;1Hx\x1B[3;1Hy\x1B[4;1Hz",
+            next.ToDiffString(previous));
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2022 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1726,7 +1726,13 @@ int string_width(const std::string& input) {
 
 std::vector<std::string> Utf8ToGlyphs(const std::string& input) {
   std::vector<std::string> out;
-  const std::string current;
+  Utf8ToGlyphs(input, &out);
+  return out;
+}
+
+void Utf8ToGlyphs(const std::string& input, std::vector<std::string>* glyphs) {
+  std::vector<std::string>& out = *glyphs;
+  out.clear();
   out.reserve(input.size());
   size_t start = 0;
   size_t end = 0;
@@ -1764,7 +1770,6 @@ std::vector<std::string> Utf8ToGlyphs(const std::string& input) {
     // Normal characters:
     out.push_back(append);
   }
-  return out;
 }
 
 int GlyphPosition(const std::string& input, size_t glyph_index, size_t start) {
@@ -1,3 +1,10 @@
+#ifndef FTXUI_SCREEN_UTIL_HPP
+#define FTXUI_SCREEN_UTIL_HPP
+
+#include <array>     // for array
+#include <charconv>  // for to_chars
+#include <string>    // for string
+
 namespace ftxui {
 namespace util {
 
@@ -7,9 +14,19 @@ constexpr const T& clamp(const T& v, const T& lo, const T& hi) {
   return v < lo ? lo : hi < v ? hi : v;
 }
 
+// Append the decimal representation of |value|, without allocating.
+inline void AppendDecimal(std::string& out, int value) {
+  std::array<char, 16> buffer;  // NOLINT
+  const auto result =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  out.append(buffer.data(), result.ptr);
+}
+
 }  // namespace util
 }  // namespace ftxui
 
+#endif  // FTXUI_SCREEN_UTIL_HPP
+
 // Copyright 2022 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.